@@ -0,0 +1,119 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "audio/decoders/wma.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Audio {
+
+/**
+ * floor(x + 0.5), clipped to the int16 range like floatToInt16(). Rounding
+ * the truncated value with the exact fractional part avoids rounding errors
+ * from adding 0.5 in single precision.
+ */
+static FORCEINLINE int32x4_t roundToInt32(float32x4_t x) {
+	x = vminq_f32(vmaxq_f32(x, vdupq_n_f32(-32768.0f)), vdupq_n_f32(32767.0f));
+
+	const int32x4_t truncated = vcvtq_s32_f32(x);
+	const float32x4_t frac = vsubq_f32(x, vcvtq_f32_s32(truncated));
+
+	// The comparisons give -1 where true
+	const int32x4_t up = vreinterpretq_s32_u32(vcgeq_f32(frac, vdupq_n_f32(0.5f)));
+	const int32x4_t down = vreinterpretq_s32_u32(vcltq_f32(frac, vdupq_n_f32(-0.5f)));
+	return vaddq_s32(vsubq_s32(truncated, up), down);
+}
+
+static FORCEINLINE int16x8_t toInt16x8(const float *src) {
+	return vcombine_s16(vqmovn_s32(roundToInt32(vld1q_f32(src))), vqmovn_s32(roundToInt32(vld1q_f32(src + 4))));
+}
+
+void WMACodec::vectorFMulAddNEON(float *dst, const float *src0, const float *src1, const float *src2, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		const float32x4_t product = vmulq_f32(vld1q_f32(src0 + i), vld1q_f32(src1 + i));
+		vst1q_f32(dst + i, vaddq_f32(product, vld1q_f32(src2 + i)));
+	}
+
+	vectorFMulAddGeneric(dst + i, src0 + i, src1 + i, src2 + i, len - i);
+}
+
+void WMACodec::vectorFMulReverseNEON(float *dst, const float *src0, const float *src1, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		float32x4_t reversed = vrev64q_f32(vld1q_f32(src1 + len - i - 4));
+		reversed = vcombine_f32(vget_high_f32(reversed), vget_low_f32(reversed));
+		vst1q_f32(dst + i, vmulq_f32(vld1q_f32(src0 + i), reversed));
+	}
+
+	vectorFMulReverseGeneric(dst + i, src0 + i, src1, len - i);
+}
+
+void WMACodec::toInt16InterleaveNEON(int16 *dst, const float **src, uint32 length, uint8 channels) {
+	uint32 i = 0;
+	if (channels == 1) {
+		for (; i + 8 <= length; i += 8)
+			vst1q_s16(dst + i, toInt16x8(src[0] + i));
+	} else if (channels == 2) {
+		for (; i + 8 <= length; i += 8) {
+			int16x8x2_t interleaved;
+			interleaved.val[0] = toInt16x8(src[0] + i);
+			interleaved.val[1] = toInt16x8(src[1] + i);
+			vst2q_s16(dst + 2 * i, interleaved);
+		}
+	} else {
+		toInt16InterleaveGeneric(dst, src, length, channels);
+		return;
+	}
+
+	// The remaining samples
+	const float *rest[2] = { src[0] + i, channels == 2 ? src[1] + i : nullptr };
+	toInt16InterleaveGeneric(dst + i * channels, rest, length - i, channels);
+}
+
+} // End of namespace Audio
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,114 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "audio/decoders/wma.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Audio {
+
+/**
+ * floor(x + 0.5), clipped to the int16 range like floatToInt16(). Rounding
+ * the truncated value with the exact fractional part avoids rounding errors
+ * from adding 0.5 in single precision.
+ */
+static FORCEINLINE __m128i roundToInt32(__m128 x) {
+	x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-32768.0f)), _mm_set1_ps(32767.0f));
+
+	const __m128i truncated = _mm_cvttps_epi32(x);
+	const __m128 frac = _mm_sub_ps(x, _mm_cvtepi32_ps(truncated));
+
+	// The comparisons give -1 where true
+	const __m128i up = _mm_castps_si128(_mm_cmpge_ps(frac, _mm_set1_ps(0.5f)));
+	const __m128i down = _mm_castps_si128(_mm_cmplt_ps(frac, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(truncated, up), down);
+}
+
+void WMACodec::vectorFMulAddSSE2(float *dst, const float *src0, const float *src1, const float *src2, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		const __m128 product = _mm_mul_ps(_mm_loadu_ps(src0 + i), _mm_loadu_ps(src1 + i));
+		_mm_storeu_ps(dst + i, _mm_add_ps(product, _mm_loadu_ps(src2 + i)));
+	}
+
+	vectorFMulAddGeneric(dst + i, src0 + i, src1 + i, src2 + i, len - i);
+}
+
+void WMACodec::vectorFMulReverseSSE2(float *dst, const float *src0, const float *src1, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		__m128 reversed = _mm_loadu_ps(src1 + len - i - 4);
+		reversed = _mm_shuffle_ps(reversed, reversed, _MM_SHUFFLE(0, 1, 2, 3));
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(src0 + i), reversed));
+	}
+
+	vectorFMulReverseGeneric(dst + i, src0 + i, src1, len - i);
+}
+
+void WMACodec::toInt16InterleaveSSE2(int16 *dst, const float **src, uint32 length, uint8 channels) {
+	uint32 i = 0;
+	if (channels == 1) {
+		for (; i + 8 <= length; i += 8) {
+			const __m128i low = roundToInt32(_mm_loadu_ps(src[0] + i));
+			const __m128i high = roundToInt32(_mm_loadu_ps(src[0] + i + 4));
+			_mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(low, high));
+		}
+	} else if (channels == 2) {
+		for (; i + 8 <= length; i += 8) {
+			const __m128i left = _mm_packs_epi32(roundToInt32(_mm_loadu_ps(src[0] + i)), roundToInt32(_mm_loadu_ps(src[0] + i + 4)));
+			const __m128i right = _mm_packs_epi32(roundToInt32(_mm_loadu_ps(src[1] + i)), roundToInt32(_mm_loadu_ps(src[1] + i + 4)));
+			_mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi16(left, right));
+			_mm_storeu_si128((__m128i *)(dst + 2 * i + 8), _mm_unpackhi_epi16(left, right));
+		}
+	} else {
+		toInt16InterleaveGeneric(dst, src, length, channels);
+		return;
+	}
+
+	// The remaining samples
+	const float *rest[2] = { src[0] + i, channels == 2 ? src[1] + i : nullptr };
+	toInt16InterleaveGeneric(dst + i * channels, rest, length - i, channels);
+}
+
+} // End of namespace Audio
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
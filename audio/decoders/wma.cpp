@@ -24,6 +24,7 @@
 
 #include "common/util.h"
 #include "common/intrinsics.h"
+#include "common/system.h"
 #include "common/error.h"
 #include "common/memstream.h"
 #include "common/compression/huffman.h"
@@ -49,13 +50,17 @@ static inline void butterflyFloats(float *v1, float *v2, int len) {
 	}
 }
 
-static inline void vectorFMulAdd(float *dst, const float *src0,
+WMACodec::FMulAddFunc WMACodec::vectorFMulAdd = nullptr;
+WMACodec::FMulReverseFunc WMACodec::vectorFMulReverse = nullptr;
+WMACodec::ToInt16Func WMACodec::toInt16Interleave = nullptr;
+
+void WMACodec::vectorFMulAddGeneric(float *dst, const float *src0,
 						  const float *src1, const float *src2, int len) {
 	while (len-- > 0)
 		*dst++ = *src0++ * *src1++ + *src2++;
 }
 
-static inline void vectorFMulReverse(float *dst, const float *src0,
+void WMACodec::vectorFMulReverseGeneric(float *dst, const float *src0,
 									 const float *src1, int len) {
 	src1 += len - 1;
 
@@ -63,6 +68,9 @@ static inline void vectorFMulReverse(float *dst, const float *src0,
 		*dst++ = *src0++ * *src1--;
 }
 
+void WMACodec::toInt16InterleaveGeneric(int16 *dst, const float **src, uint32 length, uint8 channels) {
+	floatToInt16Interleave(dst, src, length, channels);
+}
 
 WMACodec::WMACodec(int version, uint32 sampleRate, uint8 channels,
 		uint32 bitRate, uint32 blockAlign, Common::SeekableReadStream *extraData) :
@@ -100,6 +108,27 @@ WMACodec::WMACodec(int version, uint32 sampleRate, uint8 channels,
 		_audioFlags |= FLAG_STEREO;
 	}
 
+	// If no functions have been selected yet, detect and select
+	if (!vectorFMulAdd) {
+		vectorFMulAdd = vectorFMulAddGeneric;
+		vectorFMulReverse = vectorFMulReverseGeneric;
+		toInt16Interleave = toInt16InterleaveGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) {
+			vectorFMulAdd = vectorFMulAddNEON;
+			vectorFMulReverse = vectorFMulReverseNEON;
+			toInt16Interleave = toInt16InterleaveNEON;
+		}
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+			vectorFMulAdd = vectorFMulAddSSE2;
+			vectorFMulReverse = vectorFMulReverseSSE2;
+			toInt16Interleave = toInt16InterleaveSSE2;
+		}
+#endif
+	}
+
 	init(extraData);
 }
 
@@ -704,7 +733,7 @@ bool WMACodec::decodeFrame(Common::BitStream8MSB &bits, int16 *outputData) {
 
 	int16 *pcmOut = outputData + _curFrame * _channels * _frameLen;
 
-	floatToInt16Interleave(pcmOut, floatOut, _frameLen, _channels);
+	toInt16Interleave(pcmOut, floatOut, _frameLen, _channels);
 
 	// Prepare for the next frame
 	for (int i = 0; i < _channels; i++)
@@ -1113,17 +1142,21 @@ void WMACodec::calculateMDCTCoefficients(int bSize, bool *hasChannel,
 
 		} else {
 
-			for (int j = 0; j < _coefsStart; j++)
-				*coefs++ = 0.0;
+			memset(coefs, 0, _coefsStart * sizeof(float));
+			coefs += _coefsStart;
 
-			for (int j = 0;j < coefCount[i]; j++) {
-				*coefs = coefs1[j] * exponents[(j << bSize) >> eSize] * mult;
-				coefs++;
+			if (bSize == eSize) {
+				// One exponent per coefficient, the usual case for long blocks
+				for (int j = 0; j < coefCount[i]; j++)
+					coefs[j] = coefs1[j] * exponents[j] * mult;
+			} else {
+				for (int j = 0; j < coefCount[i]; j++)
+					coefs[j] = coefs1[j] * exponents[(j << bSize) >> eSize] * mult;
 			}
+			coefs += coefCount[i];
 
 			int n = _blockLen - _coefsEnd[bSize];
-			for (int j = 0; j < n; j++)
-				*coefs++ = 0.0;
+			memset(coefs, 0, n * sizeof(float));
 
 		}
 
@@ -51,6 +51,32 @@ public:
 
 	AudioStream *decodeFrame(Common::SeekableReadStream &data);
 
+	/** dst = src0 * src1 + src2, element-wise. dst may be the same as src2. */
+	typedef void (*FMulAddFunc)(float *dst, const float *src0, const float *src1, const float *src2, int len);
+	/** dst = src0 * src1, element-wise, with src1 read backwards. */
+	typedef void (*FMulReverseFunc)(float *dst, const float *src0, const float *src1, int len);
+	/** Convert planar float samples into interleaved int16 samples, rounding like floatToInt16(). */
+	typedef void (*ToInt16Func)(int16 *dst, const float **src, uint32 length, uint8 channels);
+
+	/** The vector functions in use, selected on first use when not set */
+	static FMulAddFunc vectorFMulAdd;
+	static FMulReverseFunc vectorFMulReverse;
+	static ToInt16Func toInt16Interleave;
+
+	static void vectorFMulAddGeneric(float *dst, const float *src0, const float *src1, const float *src2, int len);
+	static void vectorFMulReverseGeneric(float *dst, const float *src0, const float *src1, int len);
+	static void toInt16InterleaveGeneric(int16 *dst, const float **src, uint32 length, uint8 channels);
+#ifdef SCUMMVM_NEON
+	static void vectorFMulAddNEON(float *dst, const float *src0, const float *src1, const float *src2, int len);
+	static void vectorFMulReverseNEON(float *dst, const float *src0, const float *src1, int len);
+	static void toInt16InterleaveNEON(int16 *dst, const float **src, uint32 length, uint8 channels);
+#endif
+#ifdef SCUMMVM_SSE2
+	static void vectorFMulAddSSE2(float *dst, const float *src0, const float *src1, const float *src2, int len);
+	static void vectorFMulReverseSSE2(float *dst, const float *src0, const float *src1, int len);
+	static void toInt16InterleaveSSE2(int16 *dst, const float **src, uint32 length, uint8 channels);
+#endif
+
 private:
 	static const int kChannelsMax = 2; ///< Max number of channels we support.
 
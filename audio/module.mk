@@ -66,6 +66,16 @@ MODULE_OBJS := \
 	softsynth/eas.o \
 	softsynth/pcspk.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	decoders/wma-neon.o
+endif
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	decoders/wma-sse2.o
+endif
+
 ifndef DISABLE_NUKED_OPL
 MODULE_OBJS += \
 	softsynth/opl/nuked.o
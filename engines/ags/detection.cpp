@@ -68,6 +68,7 @@ const DebugChannelDef AGSMetaEngineDetection::debugFlagList[] = {
 	{AGS::kDebugFilePath, "FilePath", "File path debug level"},
 	{AGS::kDebugScan, "Scan", "Scan for unrecognised games"},
 	{AGS::kDebugScript, "Script", "Enable debug script dump"},
+	{AGS::kDebugDirtyRects, "DirtyRects", "Outline the screen areas updated each frame"},
 	DEBUG_CHANNEL_END
 };
 
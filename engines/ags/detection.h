@@ -32,6 +32,7 @@ enum AGSDebugChannels {
 	kDebugScan,
 	kDebugFilePath,
 	kDebugScript,
+	kDebugDirtyRects,
 };
 
 enum GameFlag {
@@ -298,6 +298,11 @@ void Character_ChangeView(CharacterInfo *chap, int vii) {
 	chap->walkwait = 0;
 	_GP(charextra)[chap->index_id].animwait = 0;
 	FindReasonableLoopForCharacter(chap);
+
+	if (chap->room == _G(displayed_room)) {
+		prefetch_view(vii, chap->loop, chap->loop);
+		prefetch_view(vii);
+	}
 }
 
 enum DirectionalLoop {
@@ -1391,6 +1391,20 @@ void precache_view(int view, int first_loop, int last_loop, bool with_sounds) {
 	Debug::Printf("\tSprite cache: %zu -> %zu KB", spcache_before / 1024u, spcache_after / 1024u);
 }
 
+void prefetch_view(int view, int first_loop, int last_loop) {
+	if ((view < 0) || (view >= _GP(game).numviews))
+		return;
+	if ((first_loop > last_loop) || (_GP(views)[view].numLoops == 0))
+		return;
+
+	first_loop = Math::Clamp(first_loop, 0, _GP(views)[view].numLoops - 1);
+	last_loop = Math::Clamp(last_loop, 0, _GP(views)[view].numLoops - 1);
+	for (int i = first_loop; i <= last_loop; ++i) {
+		for (int j = 0; j < _GP(views)[view].loops[i].numFrames; ++j)
+			_GP(spriteset).QueuePrefetch(_GP(views)[view].loops[i].frames[j].pic);
+	}
+}
+
 
 //=============================================================================
 //
@@ -52,6 +52,7 @@
 #include "ags/engine/ac/dynobj/script_object.h"
 #include "ags/engine/ac/dynobj/script_hotspot.h"
 #include "ags/engine/ac/dynobj/dynobj_manager.h"
+#include "ags/shared/gui/gui_button.h"
 #include "ags/shared/gui/gui_main.h"
 #include "ags/engine/script/cc_instance.h"
 #include "ags/engine/debugging/debug_log.h"
@@ -414,6 +415,46 @@ static void reset_temp_room() {
 	_GP(troom) = RoomStatus();
 }
 
+// Queues the sprites which the new room is likely to display soon, so that
+// they are loaded in spare frame time rather than on their first use
+static void prefetch_room_sprites() {
+	_GP(spriteset).ClearPrefetchQueue();
+
+	// Current object and character frames go first
+	for (uint32_t i = 0; i < _G(croom)->numobj; ++i) {
+		const RoomObject &obj = _G(objs)[i];
+		_GP(spriteset).QueuePrefetch(obj.num);
+		if (obj.view != RoomObject::NoView)
+			prefetch_view(obj.view, obj.loop, obj.loop);
+	}
+	for (int i = 0; i < _GP(game).numcharacters; ++i) {
+		const CharacterInfo &chi = _GP(game).chars[i];
+		if (chi.room == _G(displayed_room))
+			prefetch_view(chi.view, chi.loop, chi.loop);
+	}
+
+	// Then the visible GUI
+	for (const auto &gui : _GP(guis)) {
+		if (gui.IsVisible() && (gui.BgImage > 0))
+			_GP(spriteset).QueuePrefetch(gui.BgImage);
+	}
+	for (const auto &but : _GP(guibuts)) {
+		if (!but.IsVisible() || (but.ParentId < 0) || ((size_t)but.ParentId >= _GP(guis).size()) ||
+			!_GP(guis)[but.ParentId].IsVisible())
+			continue;
+		_GP(spriteset).QueuePrefetch(but.GetNormalImage());
+		_GP(spriteset).QueuePrefetch(but.GetMouseOverImage());
+		_GP(spriteset).QueuePrefetch(but.GetPushedImage());
+	}
+
+	// And finally the remaining loops of the characters, for walking around
+	for (int i = 0; i < _GP(game).numcharacters; ++i) {
+		const CharacterInfo &chi = _GP(game).chars[i];
+		if (chi.room == _G(displayed_room))
+			prefetch_view(chi.view);
+	}
+}
+
 // forchar = playerchar on NewRoom, or NULL if restore saved game
 void load_new_room(int newnum, CharacterInfo *forchar) {
 
@@ -845,6 +886,7 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 		_GP(play).UpdateRoomCameras(); // update auto tracking
 	}
 	init_room_drawdata();
+	prefetch_room_sprites();
 
 	set_our_eip(212);
 	invalidate_screen();
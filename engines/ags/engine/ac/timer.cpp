@@ -23,6 +23,7 @@
 #include "ags/engine/ac/timer.h"
 #include "ags/shared/core/platform.h"
 #include "ags/engine/ac/sys_events.h"
+#include "ags/shared/ac/sprite_cache.h"
 #include "ags/engine/platform/base/ags_platform_driver.h"
 #include "ags/ags.h"
 #include "ags/globals.h"
@@ -31,6 +32,7 @@ namespace AGS3 {
 
 namespace {
 const auto MAXIMUM_FALL_BEHIND = 3; // number of full frames
+const auto PREFETCH_TIME_MARGIN = 2; // ms left unused by the sprite prefetching
 }
 
 std::chrono::microseconds GetFrameDuration() {
@@ -80,8 +82,18 @@ void WaitForNextFrame() {
 	}
 
 	if (_G(next_frame_timestamp) > now) {
-		auto frame_time_remaining = _G(next_frame_timestamp) - now;
-		std::this_thread::sleep_for(frame_time_remaining);
+		// Use the spare frame time to load the sprites that are expected soon
+		auto prefetch_time = now;
+		while (_GP(spriteset).HasPendingPrefetch() &&
+			   (prefetch_time + PREFETCH_TIME_MARGIN < _G(next_frame_timestamp))) {
+			_GP(spriteset).PrefetchNext();
+			prefetch_time = AGS_Clock::now();
+		}
+
+		if (_G(next_frame_timestamp) > prefetch_time) {
+			auto frame_time_remaining = _G(next_frame_timestamp) - prefetch_time;
+			std::this_thread::sleep_for(frame_time_remaining);
+		}
 	}
 
 	_G(last_tick_time) = _G(next_frame_timestamp);
@@ -40,6 +40,12 @@ using namespace Shared;
 
 static RGB faded_out_palette[256];
 
+// Size of the blocks compared when looking for the changed screen areas
+static const int DIRTY_BLOCK_WIDTH = 64;
+static const int DIRTY_BLOCK_HEIGHT = 16;
+// Percentage of the screen area above which the whole frame is presented
+static const int FULL_REDRAW_COVERAGE = 50;
+
 
 // ----------------------------------------------------------------------------
 // ScummVMRendererGraphicsDriver
@@ -55,6 +61,7 @@ ScummVMRendererGraphicsDriver::ScummVMRendererGraphicsDriver() {
 
 ScummVMRendererGraphicsDriver::~ScummVMRendererGraphicsDriver() {
 	delete _screen;
+	_lastFrame.free();
 	ScummVMRendererGraphicsDriver::UnInit();
 }
 
@@ -155,7 +162,7 @@ void ScummVMRendererGraphicsDriver::CreateVirtualScreen() {
 	_origVirtualScreen.reset(new Bitmap(vscreen_w, vscreen_h, _srcColorDepth));
 	virtualScreen = _origVirtualScreen.get();
 	_stageVirtualScreen = virtualScreen;
-
+	_fullRedraw = true;
 
 	_lastTexPixels = nullptr;
 	_lastTexPitch = -1;
@@ -501,15 +508,16 @@ size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &bat
 	return from;
 }
 
-void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bool mode) {
+void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bool mode, const Common::Rect &area) {
 	assert(src.w == _screen->w && src.h == _screen->h && src.pitch == _screen->pitch);
-	const uint32 *srcP = (const uint32 *)src.getPixels();
-	uint32 *destP = (uint32 *)_screen->getPixels();
 	uint32 pixel;
 	int x1 = 9999, y1 = 9999, x2 = -1, y2 = -1;
 
-	for (int y = 0; y < src.h; ++y) {
-		for (int x = 0; x < src.w; ++x, ++srcP, ++destP) {
+	for (int y = area.top; y < area.bottom; ++y) {
+		const uint32 *srcP = (const uint32 *)src.getBasePtr(area.left, y);
+		uint32 *destP = (uint32 *)_screen->getBasePtr(area.left, y);
+
+		for (int x = area.left; x < area.right; ++x, ++srcP, ++destP) {
 			if (!mode) {
 				pixel = (*srcP & 0xff00ff00) |
 					((*srcP & 0xff) << 16) |
@@ -533,6 +541,96 @@ void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bo
 		_screen->addDirtyRect(Common::Rect(x1, y1, x2 + 1, y2 + 1));
 }
 
+void ScummVMRendererGraphicsDriver::addDirtyRect(const Common::Rect &r) {
+	// Join with the same columns of the previous row of blocks
+	if (!_dirtyRects.empty()) {
+		Common::Rect &last = _dirtyRects.back();
+		if (last.left == r.left && last.right == r.right && last.bottom == r.top) {
+			last.bottom = r.bottom;
+			return;
+		}
+	}
+	_dirtyRects.push_back(r);
+}
+
+bool ScummVMRendererGraphicsDriver::findDirtyRects(const Graphics::Surface &src) {
+	_dirtyRects.clear();
+	if (_fullRedraw || !_lastFrame.getPixels() || _lastFrame.w != src.w || _lastFrame.h != src.h ||
+		_lastFrame.format != src.format)
+		return false;
+
+	const int bpp = src.format.bytesPerPixel;
+	size_t dirty_area = 0;
+	for (int by = 0; by < src.h; by += DIRTY_BLOCK_HEIGHT) {
+		const int bh = MIN(DIRTY_BLOCK_HEIGHT, src.h - by);
+		int run_start = -1;
+		// One extra step past the right edge closes the last run
+		for (int bx = 0; bx < src.w + DIRTY_BLOCK_WIDTH; bx += DIRTY_BLOCK_WIDTH) {
+			bool changed = false;
+			if (bx < src.w) {
+				const int bw = MIN(DIRTY_BLOCK_WIDTH, src.w - bx);
+				for (int y = by; (y < by + bh) && !changed; ++y)
+					changed = memcmp(src.getBasePtr(bx, y), _lastFrame.getBasePtr(bx, y), bw * bpp) != 0;
+			}
+
+			// Collect horizontal runs of changed blocks
+			if (changed) {
+				if (run_start < 0)
+					run_start = bx;
+			} else if (run_start >= 0) {
+				const int run_end = MIN(bx, (int)src.w);
+				addDirtyRect(Common::Rect(run_start, by, run_end, by + bh));
+				dirty_area += (run_end - run_start) * bh;
+				run_start = -1;
+			}
+		}
+	}
+
+	// Past some point it is cheaper to present the whole frame at once
+	return dirty_area * 100 < (size_t)src.w * src.h * FULL_REDRAW_COVERAGE;
+}
+
+void ScummVMRendererGraphicsDriver::saveLastFrame(const Graphics::Surface &src, bool partial) {
+	if (partial) {
+		for (const auto &r : _dirtyRects)
+			_lastFrame.copyRectToSurface(src, r.left, r.top, r);
+	} else if (_lastFrame.getPixels() && _lastFrame.w == src.w && _lastFrame.h == src.h &&
+			   _lastFrame.format == src.format) {
+		_lastFrame.copyRectToSurface(src, 0, 0, Common::Rect(src.w, src.h));
+	} else {
+		_lastFrame.free();
+		_lastFrame.copyFrom(src);
+	}
+}
+
+void ScummVMRendererGraphicsDriver::drawDebugRects(bool partial) {
+	Graphics::Surface *screen = g_system->lockScreen();
+	if (!screen)
+		return;
+
+	_debugRects.clear();
+	if (partial) {
+		for (const auto &r : _dirtyRects) {
+			Common::Rect outline(r);
+			outline.clip(Common::Rect(screen->w, screen->h));
+			if (!outline.isEmpty()) {
+				screen->frameRect(outline, screen->format.RGBToColor(0, 255, 0));
+				_debugRects.push_back(outline);
+			}
+		}
+	} else {
+		// Full redraw is marked with a frame around the whole screen
+		const Common::Rect outline(screen->w, screen->h);
+		screen->frameRect(outline, screen->format.RGBToColor(255, 0, 0));
+		_debugRects.push_back(Common::Rect(0, 0, outline.right, 1));
+		_debugRects.push_back(Common::Rect(0, outline.bottom - 1, outline.right, outline.bottom));
+		_debugRects.push_back(Common::Rect(0, 0, 1, outline.bottom));
+		_debugRects.push_back(Common::Rect(outline.right - 1, 0, outline.right, outline.bottom));
+	}
+	g_system->unlockScreen();
+	g_system->updateScreen();
+}
+
 void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicFlip flip) {
 	Graphics::Surface *srcTransformed = nullptr;
 	if (xoff != 0 || yoff != 0 || flip != Shared::kFlip_None) {
@@ -559,6 +657,19 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		*srcTransformed :
 		virtualScreen->GetAllegroBitmap()->getSurface();
 
+	// Find which parts of the screen have changed since the last frame;
+	// areas outlined by the debug overlay have to be restored too
+	const bool invalidated = _fullRedraw;
+	const bool partial = findDirtyRects(src);
+	const size_t num_changed_rects = _dirtyRects.size();
+	if (partial) {
+		for (const auto &r : _debugRects) {
+			if (r.right <= src.w && r.bottom <= src.h)
+				_dirtyRects.push_back(r);
+		}
+	}
+	const Common::Rect fullArea(src.w, src.h);
+
 	enum {
 		kRenderInitial, kRenderDirect, kRenderToABGR, kRenderToRGBA,
 		kRenderOther
@@ -588,13 +699,14 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 
 	switch (renderMode) {
 	case kRenderToABGR:
-		// ARGB to ABGR
-		copySurface(src, false);
-		break;
-
 	case kRenderToRGBA:
-		// ARGB to RGBA
-		copySurface(src, true);
+		// ARGB to ABGR or RGBA
+		if (partial) {
+			for (const auto &r : _dirtyRects)
+				copySurface(src, renderMode == kRenderToRGBA, r);
+		} else {
+			copySurface(src, renderMode == kRenderToRGBA, fullArea);
+		}
 		break;
 
 	case kRenderOther: {
@@ -603,32 +715,60 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		Graphics::Surface srcCopy = src;
 		srcCopy.format.aLoss = 8;
 
-		_screen->blitFrom(srcCopy);
+		if (partial) {
+			for (const auto &r : _dirtyRects)
+				_screen->blitFrom(srcCopy, r, Common::Point(r.left, r.top));
+		} else {
+			_screen->blitFrom(srcCopy);
+		}
 		break;
 	}
 
 	case kRenderDirect:
 		// Blit the virtual surface directly to the screen
-		g_system->copyRectToScreen(src.getPixels(), src.pitch,
-			0, 0, src.w, src.h);
-		g_system->updateScreen();
-		if (srcTransformed) {
-			srcTransformed->free();
-			delete srcTransformed;
+		if (partial) {
+			for (const auto &r : _dirtyRects)
+				g_system->copyRectToScreen(src.getBasePtr(r.left, r.top), src.pitch,
+					r.left, r.top, r.width(), r.height());
+		} else {
+			g_system->copyRectToScreen(src.getPixels(), src.pitch,
+				0, 0, src.w, src.h);
 		}
-		return;
+		break;
 
 	default:
 		break;
 	}
 
+	// Only the converted pixels which differ are marked dirty on the temporary
+	// screen, so make sure it is pushed in full when the real screen is stale
+	if (renderMode != kRenderDirect) {
+		if (invalidated)
+			_screen->markAllDirty();
+		for (const auto &r : _debugRects) {
+			if (r.right <= _screen->w && r.bottom <= _screen->h)
+				_screen->addDirtyRect(r);
+		}
+	}
+
+	_dirtyRects.resize(num_changed_rects);
+	saveLastFrame(src, partial);
+	_fullRedraw = false;
+
 	if (srcTransformed) {
 		srcTransformed->free();
 		delete srcTransformed;
 	}
 
-	if (_screen)
+	if (renderMode == kRenderDirect)
+		g_system->updateScreen();
+	else
 		_screen->update();
+
+	if (debugChannelSet(-1, ::AGS::kDebugDirtyRects))
+		drawDebugRects(partial);
+	else
+		_debugRects.clear();
 }
 
 void ScummVMRendererGraphicsDriver::Render(int xoff, int yoff, GraphicFlip flip) {
@@ -168,6 +168,7 @@ public:
 	bool HasAcceleratedTransform() override { return false; }
 	bool UsesMemoryBackBuffer() override { return true; }
 	bool ShouldReleaseRenderTargets() override { return false; }
+	void InvalidateDisplay() override { _fullRedraw = true; }
 
 	const char *GetDriverName() override {
 		return "ScummVM 2D renderer";
@@ -251,6 +252,15 @@ private:
 	Graphics::Screen *_screen = nullptr;
 	PSDLRenderFilter _filter;
 
+	// Copy of the last presented frame, used to find the changed screen areas
+	Graphics::Surface _lastFrame;
+	// Tells that the next frame has to be presented in full
+	bool _fullRedraw = true;
+	// Screen areas which differ from the last presented frame
+	std::vector<Common::Rect> _dirtyRects;
+	// Screen areas outlined by the debug overlay, which must be restored
+	std::vector<Common::Rect> _debugRects;
+
 	bool _hasGamma = false;
 #ifdef TODO
 	uint16 _defaultGammaRed[256] {};
@@ -299,7 +309,16 @@ private:
 	void __fade_from_range(PALETTE source, PALETTE dest, int speed, int from, int to);
 	void __fade_out_range(int speed, int from, int to, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	// Copy raw screen bitmap pixels to the screen
-	void copySurface(const Graphics::Surface &src, bool mode);
+	void copySurface(const Graphics::Surface &src, bool mode, const Common::Rect &area);
+	// Fills the dirty rects list by comparing the frame with the last presented one;
+	// returns false if the whole frame should be presented instead
+	bool findDirtyRects(const Graphics::Surface &src);
+	// Adds a rect to the dirty list, merging it with the previous one when possible
+	void addDirtyRect(const Common::Rect &r);
+	// Remembers the presented frame for the comparison with the next one
+	void saveLastFrame(const Graphics::Surface &src, bool partial);
+	// Outlines the updated screen areas on the real screen
+	void drawDebugRects(bool partial);
 	// Render bitmap on screen
 	void Present(int xoff = 0, int yoff = 0, Shared::GraphicFlip flip = Shared::kFlip_None);
 };
@@ -111,6 +111,9 @@ public:
 	// Tells if this gfx driver requires releasing render targets
 	// in case of display mode change or reset.
 	virtual bool ShouldReleaseRenderTargets() = 0;
+	// Tells the driver that the real screen was drawn upon bypassing it,
+	// so the next frame has to be presented in full
+	virtual void InvalidateDisplay() = 0;
 
 	virtual void SetTintMethod(TintMethod method) = 0;
 	// Initialize given display mode
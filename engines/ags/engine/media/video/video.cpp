@@ -138,6 +138,7 @@ static bool play_video(Video::VideoDecoder *decoder, const char *name, int flags
 	}
 
 	// Clear the screen after playback
+	_G(gfxDriver)->InvalidateDisplay();
 	if (_G(gfxDriver)->UsesMemoryBackBuffer())
 		_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
 	render_to_screen();
@@ -47,6 +47,8 @@ using namespace AGS::Shared;
 #define SPRCACHEFLAG_ERROR	  0x04
 // Locked sprites are ones that should not be freed when out of cache space.
 #define SPRCACHEFLAG_LOCKED	  0x08
+// Tells that the sprite was loaded by prefetching and was not requested yet.
+#define SPRCACHEFLAG_PREFETCHED 0x10
 
 // High-verbosity sprite cache log
 #if DEBUG_SPRITECACHE
@@ -106,6 +108,8 @@ void SpriteCache::Reset() {
 	_mru.clear();
 	_cacheSize = 0;
 	_lockedSize = 0;
+	ClearPrefetchQueue();
+	ResetStats();
 }
 
 bool SpriteCache::SetSprite(sprkey_t index, std::unique_ptr<Bitmap> image, int flags) {
@@ -223,15 +227,23 @@ Bitmap *SpriteCache::operator[](sprkey_t index) {
 		return _placeholder.get();
 
 	// Externally added sprite or locked sprite, don't put it into MRU list
-	if (_spriteData[index].IsExternalSprite() || _spriteData[index].IsLocked())
+	if (_spriteData[index].IsExternalSprite() || _spriteData[index].IsLocked()) {
+		_stats.Hits++;
 		return _spriteData[index].Image.get();
+	}
 	// Either use ready image, or load one from assets
 	if (_spriteData[index].Image) {
+		_stats.Hits++;
+		if (_spriteData[index].Flags & SPRCACHEFLAG_PREFETCHED) {
+			_spriteData[index].Flags &= ~SPRCACHEFLAG_PREFETCHED;
+			_stats.PrefetchHits++;
+		}
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
 		return _spriteData[index].Image.get();
 	} else {
 		// Sprite exists in file but is not in mem, load it and add to MRU list
+		_stats.Misses++;
 		if (LoadSprite(index)) {
 			_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
 			return _spriteData[index].Image.get();
@@ -276,6 +288,9 @@ void SpriteCache::DisposeOldest() {
 	if (!_spriteData[sprnum].IsLocked()) {
 		_cacheSize -= _spriteData[sprnum].Size;
 		_spriteData[sprnum].Image.reset();
+		// An evicted prefetch never counts as a hit, even if loaded again
+		_spriteData[sprnum].Flags &= ~SPRCACHEFLAG_PREFETCHED;
+		_stats.Evictions++;
 		SprCacheLog("DisposeOldest: disposed %d, size now %d KB", sprnum, _cacheSize / 1024);
 	}
 	// Remove from the mru list
@@ -287,7 +302,7 @@ void SpriteCache::DisposeOldest() {
 
 void SpriteCache::DisposeCached(sprkey_t index) {
 	if (IsAssetSprite(index)) {
-		_spriteData[index].Flags &= ~SPRCACHEFLAG_LOCKED;
+		_spriteData[index].Flags &= ~(SPRCACHEFLAG_LOCKED | SPRCACHEFLAG_PREFETCHED);
 		_spriteData[index].Image.reset();
 	}
 	_cacheSize = _lockedSize;
@@ -299,6 +314,7 @@ void SpriteCache::DisposeAllFreeCached() {
 			_spriteData[i].IsAssetSprite()) // sprite from game resource
 		{
 			_spriteData[i].Image.reset();
+			_spriteData[i].Flags &= ~SPRCACHEFLAG_PREFETCHED;
 		}
 	}
 	_cacheSize = _lockedSize;
@@ -331,6 +347,52 @@ void SpriteCache::PrecacheSprite(sprkey_t index) {
 	SprCacheLog("Precached %d", index);
 }
 
+void SpriteCache::QueuePrefetch(sprkey_t index) {
+	if (IsAssetSprite(index))
+		_prefetchQueue.push_back(index);
+}
+
+void SpriteCache::ClearPrefetchQueue() {
+	_prefetchQueue.clear();
+	_prefetchPos = 0;
+}
+
+bool SpriteCache::HasPendingPrefetch() const {
+	return _prefetchPos < _prefetchQueue.size();
+}
+
+bool SpriteCache::PrefetchNext() {
+	while (_prefetchPos < _prefetchQueue.size()) {
+		const sprkey_t index = _prefetchQueue[_prefetchPos++];
+		if (!IsAssetSprite(index) || _spriteData[index].Image || _spriteData[index].IsError())
+			continue; // already loaded, or cannot be loaded
+
+		// Prefetching must not push out the sprites that are in use; the final
+		// color depth is unknown until the sprite is loaded, so assume 32-bit
+		const size_t size_guess = _sprInfos[index].Width * _sprInfos[index].Height * 4;
+		if (_cacheSize + size_guess > _maxCacheSize) {
+			_stats.PrefetchSkips++;
+			continue;
+		}
+
+		if (LoadSprite(index)) {
+			_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
+			_spriteData[index].Flags |= SPRCACHEFLAG_PREFETCHED;
+			_stats.Prefetched++;
+			SprCacheLog("Prefetched %d", index);
+		}
+		break;
+	}
+
+	if (!HasPendingPrefetch())
+		ClearPrefetchQueue();
+	return HasPendingPrefetch();
+}
+
+void SpriteCache::ResetStats() {
+	_stats = Stats();
+}
+
 void SpriteCache::LockSprite(sprkey_t index) {
 	assert(index >= 0); // out of positive range indexes are valid to fail
 	if (index < 0 || (size_t)index >= _spriteData.size())
@@ -391,6 +453,8 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 	FreeMem(size);
 	// Add to the cache, lock if requested or if it's sprite 0
 	const bool should_lock = lock || (index == 0);
+	// (fresh flags, so a regular load is never counted as prefetched;
+	// only PrefetchNext() sets that flag, after loading)
 	_spriteData[index] = SpriteData(image, size, SPRCACHEFLAG_ISASSET);
 	_spriteData[index].Flags |= (SPRCACHEFLAG_LOCKED * should_lock);
 	_cacheSize += size;
@@ -95,6 +95,16 @@ public:
 		PfnPrewriteSprite PrewriteSprite;
 	};
 
+	// Usage counters, for diagnostic purposes
+	struct Stats {
+		uint32_t Hits = 0;          // requested sprites found in memory
+		uint32_t Misses = 0;        // requested sprites that had to be loaded
+		uint32_t Evictions = 0;     // sprites disposed to free up space
+		uint32_t Prefetched = 0;    // sprites loaded ahead from the prefetch queue
+		uint32_t PrefetchHits = 0;  // prefetched sprites that were requested later
+		uint32_t PrefetchSkips = 0; // queued sprites that did not fit into the cache
+	};
+
 	SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks);
 	~SpriteCache() = default;
 
@@ -175,6 +185,22 @@ public:
 	// Sets max cache size in bytes
 	void        SetMaxCacheSize(size_t size);
 
+	// Adds asset sprite to the prefetch queue; queued sprites are loaded
+	// one by one with PrefetchNext, whenever the engine has spare time
+	void        QueuePrefetch(sprkey_t index);
+	// Drops all the pending prefetch requests
+	void        ClearPrefetchQueue();
+	// Tells if there are prefetch requests left in the queue
+	bool        HasPendingPrefetch() const;
+	// Takes next sprite from the prefetch queue and loads it, unless it is
+	// already in memory, or does not fit into the cache without disposing
+	// other sprites. Returns whether the queue has more sprites left.
+	bool        PrefetchNext();
+	// Returns usage counters
+	const Stats &GetStats() const { return _stats; }
+	// Resets usage counters
+	void        ResetStats();
+
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Bitmap *operator[](sprkey_t index);
 
@@ -245,6 +271,11 @@ private:
 	// that were last time used long ago.
 	std::list<sprkey_t> _mru;
 
+	// Sprites waiting to be loaded ahead of their first use
+	std::vector<sprkey_t> _prefetchQueue;
+	size_t _prefetchPos = 0;
+
+	Stats _stats;
 };
 
 } // namespace Shared
@@ -140,6 +140,7 @@ VQADecoder::VQADecoder() {
 	_header.unk5         = 0;
 	_readingFrame        = -1;
 	_decodingFrame       = -1;
+	_prefetchedFrame     = -1;
 	_vqpPalsArr          = nullptr;
 	_numOfVQPPalettes    = 0;
 	_oldV2VQA                 = false;
@@ -170,6 +171,9 @@ void VQADecoder::close() {
 
 	_loopInfo.close();
 
+	_prefetchedFrame = -1;
+	_prefetchData.clear();
+
 	deleteVQPTable();
 }
 
@@ -256,34 +260,34 @@ void VQADecoder::decodeLights(Lights *lights) {
 	_videoTrack->decodeLights(lights);
 }
 
-void VQADecoder::readPacket(uint readFlags) {
+void VQADecoder::readPacket(Common::SeekableReadStream *s, uint readFlags) {
 	IFFChunkHeader chd;
 
-	if (remain(_s) < 8) {
-		warning("VQADecoder::readPacket(): remain: %d", remain(_s));
-		assert(remain(_s) < 8);
+	if (remain(s) < 8) {
+		warning("VQADecoder::readPacket(): remain: %d", remain(s));
+		assert(remain(s) < 8);
 	}
 
 	do {
-		if (!readIFFChunkHeader(_s, &chd)) {
+		if (!readIFFChunkHeader(s, &chd)) {
 			error("VQADecoder::readPacket(): Error reading chunk header");
 		}
 
 		bool rc = false;
 		// Video track
 		switch (chd.id) {
-		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readAESC(_s, chd.size); break;
-		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readLITE(_s, chd.size); break;
-		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVIEW(_s, chd.size); break;
-		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFL(_s, chd.size, readFlags); break;
-		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFR(_s, chd.size, readFlags); break;
-		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readZBUF(_s, chd.size); break;
+		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readAESC(s, chd.size); break;
+		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readLITE(s, chd.size); break;
+		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVIEW(s, chd.size); break;
+		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFL(s, chd.size, readFlags); break;
+		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFR(s, chd.size, readFlags); break;
+		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readZBUF(s, chd.size); break;
 		// Sound track
-		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSN2J(_s, chd.size); break;
-		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSND2(_s, chd.size); break;
+		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSN2J(s, chd.size); break;
+		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSND2(s, chd.size); break;
 		default:
 			rc = false;
-			_s->skip(roundup(chd.size));
+			s->skip(roundup(chd.size));
 		}
 
 		if (!rc) {
@@ -298,11 +302,48 @@ void VQADecoder::readFrame(int frame, uint readFlags) {
 		error("VQADecoder::readFrame(): frame %d out of bounds, frame count is %d", frame, numFrames());
 	}
 
+	_readingFrame = frame;
+
+	if (frame == _prefetchedFrame) {
+		Common::MemoryReadStream s(_prefetchData.data(), _prefetchData.size());
+		readPacket(&s, readFlags);
+		return;
+	}
+
 	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
 	_s->seek(frameOffset);
 
-	_readingFrame = frame;
-	readPacket(readFlags);
+	readPacket(_s, readFlags);
+}
+
+void VQADecoder::prefetchFrame(int frame) {
+	if (frame == _prefetchedFrame || frame < 0 || frame >= numFrames()) {
+		return;
+	}
+
+	_prefetchedFrame = -1;
+
+	// Find where the packet of the frame ends, it is terminated by the VQFR chunk
+	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+	_s->seek(frameOffset);
+
+	IFFChunkHeader chd;
+	do {
+		if (!readIFFChunkHeader(_s, &chd)) {
+			return;
+		}
+		_s->skip(roundup(chd.size));
+	} while (chd.id != kVQFR);
+
+	uint32 packetSize = _s->pos() - frameOffset;
+	_prefetchData.resize(packetSize);
+
+	_s->seek(frameOffset);
+	if (_s->read(_prefetchData.data(), packetSize) != packetSize) {
+		return;
+	}
+
+	_prefetchedFrame = frame;
 }
 
 bool VQADecoder::readVQHD(Common::SeekableReadStream *s, uint32 size) {
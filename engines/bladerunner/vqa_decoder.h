@@ -67,6 +67,7 @@ public:
 	void close();
 
 	void readFrame(int frame, uint readFlags = kVQAReadAll);
+	void prefetchFrame(int frame);
 
 	void                        decodeVideoFrame(Graphics::Surface *surface, int frame, bool forceDraw = false);
 	void                        decodeZBuffer(ZBuffer *zbuffer);
@@ -163,6 +164,11 @@ public:
 	int      _decodingFrame;
 	LoopInfo _loopInfo;
 
+	// Raw packet of a frame read ahead of time, readFrame() parses it
+	// from memory instead of going to the stream
+	int                 _prefetchedFrame;
+	Common::Array<byte> _prefetchData;
+
 	VQPPalette *_vqpPalsArr;
 	uint16      _numOfVQPPalettes;
 
@@ -184,7 +190,7 @@ public:
 	VQAVideoTrack *_videoTrack;
 	VQAAudioTrack *_audioTrack;
 
-	void readPacket(uint readFlags);
+	void readPacket(Common::SeekableReadStream *s, uint readFlags);
 
 	bool readVQHD(Common::SeekableReadStream *s, uint32 size);
 	bool readMSCI(Common::SeekableReadStream *s, uint32 size);
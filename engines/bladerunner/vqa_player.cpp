@@ -276,6 +276,13 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 		// Note, we use unsigned difference to avoid potential time overflow issues
 		result = -1;
 
+		// Use the wait to read the packet of the next frame from the disk.
+		// When a loop jump or a seek picks another frame, the prefetched
+		// packet is simply not used.
+		if (advanceFrame) {
+			_decoder.prefetchFrame(_frameNext);
+		}
+
 	} else if (advanceFrame) {
 		_frame = _frameNext;
 		_decoder.readFrame(_frameNext, kVQAReadVideo);
@@ -79,7 +79,7 @@ Conf::Conf(InterpreterType interpType) : _interpType(interpType), _graphics(true
 		_windowColor(parseColor(WHITE)), _windowSave(parseColor(WHITE)),
 		_sound(true), _speak(false), _speakInput(false), _styleHint(1),
 		_scrollBg(parseColor(SCROLL_BG)), _scrollFg(parseColor(SCROLL_FG)),
-		_scrollWidth(0), _safeClicks(false) {
+		_scrollWidth(0), _scrollBack(0), _safeClicks(false) {
 	g_conf = this;
 	_imageW = _width;
 	_imageH = _height;
@@ -210,6 +210,10 @@ void Conf::synchronize() {
 	syncAsInt("scrollwidth", _scrollWidth);
 	syncAsColor("scrollbg", _scrollBg);
 	syncAsColor("scrollfg", _scrollFg);
+	syncAsInt("scrollback", _scrollBack);
+	if (_isLoading && _scrollBack)
+		// Text buffers start out with SCROLLBACK lines, so a smaller limit can't be honored
+		_scrollBack = MAX(_scrollBack, SCROLLBACK);
 	syncAsInt("justify", _propInfo._justify);
 	syncAsInt("quotes", _propInfo._quotes);
 	syncAsInt("dashes", _propInfo._dashes);
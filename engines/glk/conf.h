@@ -92,6 +92,7 @@ public:
 	uint _windowColor, _windowSave;
 	int _scrollWidth;
 	uint _scrollBg, _scrollFg;
+	int _scrollBack;		///< Maximum text buffer scrollback in lines (at least SCROLLBACK), or 0 for unlimited
 	bool _graphics;
 	bool _sound;
 	bool _speak;
@@ -48,44 +48,56 @@ void Glulx::execute_loop() {
 		/* Stash the current opcode's address, in case the interpreter needs to serialize the VM state out-of-band. */
 		prevpc = pc;
 
-		/* Fetch the opcode number. */
-		opcode = Mem1(pc);
-		pc++;
-		if (opcode & 0x80) {
-			/* More than one-byte opcode. */
-			if (opcode & 0x40) {
-				/* Four-byte opcode */
-				opcode &= 0x3F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-			} else {
-				/* Two-byte opcode */
-				opcode &= 0x7F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
+		if (pc < ramstart) {
+			/* Code in ROM can't change, so each instruction there only has to be
+			   decoded once; after that just its operands have to be fetched. */
+			decodedop_t *op = &opcache[pc & (OPCACHE_SIZE - 1)];
+			if (op->pc != pc)
+				decode_instruction(op);
+
+			opcode = op->opcode;
+			pc = op->nextpc;
+			eval_operands(inst, op);
+		} else {
+			/* Fetch the opcode number. */
+			opcode = Mem1(pc);
+			pc++;
+			if (opcode & 0x80) {
+				/* More than one-byte opcode. */
+				if (opcode & 0x40) {
+					/* Four-byte opcode */
+					opcode &= 0x3F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				} else {
+					/* Two-byte opcode */
+					opcode &= 0x7F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				}
 			}
-		}
 
-		/* Now we have an opcode number. */
+			/* Now we have an opcode number. */
 
-		/* Fetch the structure that describes how the operands for this
-		   opcode are arranged. This is a pointer to an immutable,
-		   static object. */
-		if (opcode < 0x80)
-			oplist = fast_operandlist[opcode];
-		else
-			oplist = lookup_operandlist(opcode);
+			/* Fetch the structure that describes how the operands for this
+			   opcode are arranged. This is a pointer to an immutable,
+			   static object. */
+			if (opcode < 0x80)
+				oplist = fast_operandlist[opcode];
+			else
+				oplist = lookup_operandlist(opcode);
 
-		if (!oplist)
-			fatal_error_i("Encountered unknown opcode.", opcode);
+			if (!oplist)
+				fatal_error_i("Encountered unknown opcode.", opcode);
 
-		/* Based on the oplist structure, load the actual operand values
-		   into inst. This moves the PC up to the end of the instruction. */
-		parse_operands(inst, oplist);
+			/* Based on the oplist structure, load the actual operand values
+			   into inst. This moves the PC up to the end of the instruction. */
+			parse_operands(inst, oplist);
+		}
 
 		/* Perform the opcode. This switch statement is split in two, based
 		   on some paranoid suspicions about the ability of compilers to
@@ -40,10 +40,12 @@ Glulx::Glulx(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst, g
 		classes_table(0), indiv_prop_start(0), class_metaclass(0), object_metaclass(0),
 		routine_metaclass(0), string_metaclass(0), self(0), num_attr_bytes(0), cpv__start(0),
 		accelentries(nullptr),
+		// operand
+		opcache(nullptr),
 		// heap
 		heap_start(0), alloc_count(0), heap_head(nullptr), heap_tail(nullptr),
 		// serial
-		max_undo_level(8), undo_chain_size(0), undo_chain_num(0), undo_chain(nullptr), ramcache(nullptr),
+		max_undo_level(8), max_undo_size(0x400000), undo_ram(nullptr), undo_ramend(0), ramcache(nullptr),
 		// string
 		iosys_mode(0), iosys_rock(0), tablecache_valid(false), glkio_unichar_han_ptr(nullptr) {
 	g_vm = this;
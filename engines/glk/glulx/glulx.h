@@ -28,6 +28,7 @@
 #include "common/random.h"
 #include "glk/glk_api.h"
 #include "glk/glulx/glulx_types.h"
+#include "glk/glulx/undo_chain.h"
 
 namespace Glk {
 namespace Glulx {
@@ -145,6 +146,12 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Cache of decoded instructions, indexed by their address. Only instructions in ROM
+	 * are cached, since they can't be modified.
+	 */
+	decodedop_t *opcache;
+
 	/**@}*/
 
 	/**
@@ -157,9 +164,20 @@ private:
 	 */
 	int max_undo_level;
 
-	int undo_chain_size;
-	int undo_chain_num;
-	byte **undo_chain;
+	/**
+	 * Total size in bytes the undo chain may use before its oldest states are dropped.
+	 */
+	uint max_undo_size;
+
+	UndoChain undo_chain;
+
+	/**
+	 * Copy of RAM (ramstart to undo_ramend) as of the most recent undo save. Each state in
+	 * the undo chain only stores its RAM as a delta against the state saved before it, and
+	 * restoring one turns this copy back into that previous state.
+	 */
+	byte *undo_ram;
+	uint undo_ramend;
 
 	/**
 	 * This will contain a copy of RAM (ramstate to endmem) as it exists in the game file.
@@ -352,9 +370,13 @@ protected:
 	 */
 
 	uint write_memstate(dest_t *dest);
+	uint write_undo_memstate(dest_t *dest);
 	uint write_heapstate(dest_t *dest, int portable);
 	uint write_stackstate(dest_t *dest, int portable);
 	uint read_memstate(dest_t *dest, uint chunklen);
+	uint read_undo_memstate(dest_t *dest);
+	uint apply_undo_memstate(const byte *ptr, uint chunklen);
+	uint update_undo_ram();
 	uint read_heapstate(dest_t *dest, uint chunklen, int portable, uint *sumlen, uint **summary);
 	uint read_stackstate(dest_t *dest, uint chunklen, int portable);
 	uint write_heapstate_sub(uint sumlen, uint *sumarray, dest_t *dest, int portable);
@@ -551,6 +573,18 @@ public:
 	*/
 	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
 
+	/**
+	 * Decode the instruction at the PC into op, without moving the PC or touching the stack.
+	 * op->pc is only set if the whole instruction lies in ROM, so that it can be reused.
+	 */
+	void decode_instruction(decodedop_t *op);
+
+	/**
+	 * Put the operand values of a decoded instruction in args, the same way as parse_operands().
+	 * Unlike it, this doesn't move the PC.
+	 */
+	void eval_operands(oparg_t *opargs, const decodedop_t *op);
+
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
 	 * the result of an opcode, but it's also used by any code that pulls a call-stub off the stack.
@@ -351,6 +351,26 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * An instruction in ROM, as decoded by decode_instruction(). The addressing mode of each
+ * operand is kept along with its constant value or address, so that executing it again
+ * only needs to do the actual stack, locals and memory accesses.
+ */
+struct decodedop_struct {
+	uint pc;                        ///< Address of the instruction, or 0 if the entry is unused
+	uint nextpc;                    ///< Address of the instruction following it
+	uint opcode;
+	const operandlist_t *oplist;
+	byte modes[MAX_OPERANDS];
+	uint values[MAX_OPERANDS];
+};
+typedef decodedop_struct decodedop_t;
+
+/**
+ * Number of entries in the decoded instruction cache. Must be a power of two.
+ */
+#define OPCACHE_SIZE (0x4000)
+
 typedef uint(Glulx::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
@@ -66,6 +66,14 @@ static const operandlist_t list_LLSS = { 4, 4, &array_LLSS[0] };
 void Glulx::init_operands() {
 	for (int ix = 0; ix < 0x80; ix++)
 		fast_operandlist[ix] = lookup_operandlist(ix);
+
+	if (!opcache) {
+		opcache = (decodedop_t *)glulx_malloc(OPCACHE_SIZE * sizeof(decodedop_t));
+		if (!opcache)
+			fatal_error("Unable to allocate the instruction cache.");
+	}
+	for (int ix = 0; ix < OPCACHE_SIZE; ix++)
+		opcache[ix].pc = 0;
 }
 
 const operandlist_t *Glulx::lookup_operandlist(uint opcode) {
@@ -516,6 +524,218 @@ WrLocalsAddr:
 	}
 }
 
+void Glulx::decode_instruction(decodedop_t *op) {
+	uint addr = pc;
+	uint opcode, modeaddr;
+	const operandlist_t *oplist;
+	int ix, numops;
+	int modeval = 0;
+
+	/* Fetch the opcode number, the same way as execute_loop(). */
+	opcode = Mem1(addr);
+	addr++;
+	if (opcode & 0x80) {
+		if (opcode & 0x40) {
+			opcode &= 0x3F;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+		} else {
+			opcode &= 0x7F;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+		}
+	}
+
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		fatal_error_i("Encountered unknown opcode.", opcode);
+
+	numops = oplist->num_ops;
+	modeaddr = addr;
+	addr += (numops + 1) / 2;
+
+	for (ix = 0; ix < numops; ix++) {
+		int mode;
+		uint value = 0;
+
+		if ((ix & 1) == 0) {
+			modeval = Mem1(modeaddr);
+			mode = (modeval & 0x0F);
+		} else {
+			mode = ((modeval >> 4) & 0x0F);
+			modeaddr++;
+		}
+
+		/* Only the constant part is read here; invalid modes are
+		   reported by eval_operands(). */
+		switch (mode) {
+		case 1:
+			value = (int)(signed char)(Mem1(addr));
+			addr++;
+			break;
+		case 2:
+			value = (int)(signed char)(Mem1(addr));
+			value = (value << 8) | (uint)(Mem1(addr + 1));
+			addr += 2;
+			break;
+		case 3:
+			value = Mem4(addr);
+			addr += 4;
+			break;
+		case 5:
+		case 9:
+			value = (uint)(Mem1(addr));
+			addr++;
+			break;
+		case 6:
+		case 10:
+			value = (uint)Mem2(addr);
+			addr += 2;
+			break;
+		case 7:
+		case 11:
+			value = Mem4(addr);
+			addr += 4;
+			break;
+		case 13:
+			value = (uint)(Mem1(addr)) + ramstart;
+			addr++;
+			break;
+		case 14:
+			value = (uint)Mem2(addr) + ramstart;
+			addr += 2;
+			break;
+		case 15:
+			value = Mem4(addr) + ramstart;
+			addr += 4;
+			break;
+		default:
+			break;
+		}
+
+		op->modes[ix] = mode;
+		op->values[ix] = value;
+	}
+
+	op->opcode = opcode;
+	op->oplist = oplist;
+	op->nextpc = addr;
+	op->pc = (addr <= ramstart) ? pc : 0;
+}
+
+void Glulx::eval_operands(oparg_t *args, const decodedop_t *op) {
+	const operandlist_t *oplist = op->oplist;
+	int numops = oplist->num_ops;
+	int argsize = oplist->arg_size;
+	oparg_t *curarg = args;
+
+	for (int ix = 0; ix < numops; ix++, curarg++) {
+		uint value = op->values[ix];
+		uint addr = value;
+
+		curarg->desttype = 0;
+
+		if (oplist->formlist[ix] == modeform_Load) {
+			switch (op->modes[ix]) {
+			case 8: /* pop off stack */
+				if (stackptr < valstackbase + 4) {
+					fatal_error("Stack underflow in operand.");
+				}
+				stackptr -= 4;
+				value = Stk4(stackptr);
+				break;
+
+			case 0:
+			case 1:
+			case 2:
+			case 3: /* constants */
+				break;
+
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15: /* main memory */
+				if (argsize == 4) {
+					value = Mem4(addr);
+				} else if (argsize == 2) {
+					value = Mem2(addr);
+				} else {
+					value = Mem1(addr);
+				}
+				break;
+
+			case 9:
+			case 10:
+			case 11: /* locals */
+				addr += localsbase;
+				if (argsize == 4) {
+					value = Stk4(addr);
+				} else if (argsize == 2) {
+					value = Stk2(addr);
+				} else {
+					value = Stk1(addr);
+				}
+				break;
+
+			default:
+				value = 0;
+				fatal_error("Unknown addressing mode in load operand.");
+			}
+
+			curarg->value = value;
+
+		} else { /* modeform_Store */
+			switch (op->modes[ix]) {
+			case 0: /* discard value */
+				curarg->desttype = 0;
+				curarg->value = 0;
+				break;
+
+			case 8: /* push on stack */
+				curarg->desttype = 3;
+				curarg->value = 0;
+				break;
+
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15: /* main memory */
+				curarg->desttype = 1;
+				curarg->value = addr;
+				break;
+
+			case 9:
+			case 10:
+			case 11: /* locals, relative to the current locals segment */
+				curarg->desttype = 2;
+				curarg->value = addr;
+				break;
+
+			case 1:
+			case 2:
+			case 3:
+				fatal_error("Constant addressing mode in store operand.");
+				break;
+
+			default:
+				fatal_error("Unknown addressing mode in store operand.");
+			}
+		}
+	}
+}
+
 void Glulx::store_operand(uint desttype, uint destaddr, uint storeval) {
 	switch (desttype) {
 
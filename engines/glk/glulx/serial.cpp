@@ -26,11 +26,12 @@ namespace Glulx {
 
 #define IFFID(c1, c2, c3, c4) MKTAG(c1, c2, c3, c4)
 
+/* Unchanged RAM is skipped in blocks of this many bytes when computing
+   undo deltas. */
+#define UNDO_BLOCK (64)
+
 bool Glulx::init_serial() {
-	undo_chain_num = 0;
-	undo_chain_size = max_undo_level;
-	undo_chain = (unsigned char **)glulx_malloc(sizeof(unsigned char *) * undo_chain_size);
-	if (!undo_chain)
+	if (!undo_chain.init(max_undo_level))
 		return false;
 
 #ifdef SERIALIZE_CACHE_RAM
@@ -52,16 +53,13 @@ bool Glulx::init_serial() {
 }
 
 void Glulx::final_serial() {
-	if (undo_chain) {
-		int ix;
-		for (ix = 0; ix < undo_chain_num; ix++) {
-			glulx_free(undo_chain[ix]);
-		}
-		glulx_free(undo_chain);
+	undo_chain.clear();
+
+	if (undo_ram) {
+		glulx_free(undo_ram);
+		undo_ram = nullptr;
 	}
-	undo_chain = nullptr;
-	undo_chain_size = 0;
-	undo_chain_num = 0;
+	undo_ramend = 0;
 
 #ifdef SERIALIZE_CACHE_RAM
 	if (ramcache) {
@@ -81,9 +79,11 @@ uint Glulx::perform_saveundo() {
 	   just have a memory chunk, a heap chunk, and a stack chunk, in
 	   that order. We skip the IFF chunk headers (although the size
 	   fields are still there.) We also don't bother with IFF's 16-bit
-	   alignment. */
+	   alignment. The memory chunk is a delta against the previous
+	   undo-save rather than against the game file, see
+	   write_undo_memstate(). */
 
-	if (undo_chain_size == 0)
+	if (undo_chain.size() == 0)
 		return 1;
 
 	dest._isMem = true;
@@ -94,7 +94,7 @@ uint Glulx::perform_saveundo() {
 	}
 	if (res == 0) {
 		memstart = dest._pos;
-		res = write_memstate(&dest);
+		res = write_undo_memstate(&dest);
 		memlen = dest._pos - memstart;
 	}
 	if (res == 0) {
@@ -140,17 +140,14 @@ uint Glulx::perform_saveundo() {
 	}
 
 	if (res == 0) {
-		/* It worked. */
-		if (undo_chain_num >= undo_chain_size) {
-			glulx_free(undo_chain[undo_chain_num - 1]);
-			undo_chain[undo_chain_num - 1] = nullptr;
-		}
-		if (undo_chain_size > 1)
-			memmove(undo_chain + 1, undo_chain,
-			        (undo_chain_size - 1) * sizeof(unsigned char *));
-		undo_chain[0] = dest._ptr;
-		if (undo_chain_num < undo_chain_size)
-			undo_chain_num += 1;
+		/* The delta base has to move forward along with the chain. */
+		res = update_undo_ram();
+	}
+
+	if (res == 0) {
+		/* It worked. The chain takes ownership of the new state and drops
+		   the oldest ones once it's full or too big. */
+		undo_chain.push(dest._ptr, max_undo_size);
 		dest._ptr = nullptr;
 	} else {
 		/* It didn't work. */
@@ -168,6 +165,7 @@ uint Glulx::perform_restoreundo() {
 	uint res, val = 0;
 	uint heapsumlen = 0;
 	uint *heapsumarr = nullptr;
+	uint memstart = 0, memlen = 0;
 
 	/* If profiling is enabled and active then fail. */
 #ifdef VM_PROFILING
@@ -175,18 +173,20 @@ uint Glulx::perform_restoreundo() {
 		return 1;
 #endif /* VM_PROFILING */
 
-	if (undo_chain_size == 0 || undo_chain_num == 0)
+	if (undo_chain.count() == 0)
 		return 1;
 
 	dest._isMem = true;
-	dest._ptr = undo_chain[0];
+	dest._ptr = undo_chain.newest();
 
 	res = 0;
 	if (res == 0) {
-		res = read_long(&dest, &val);
+		res = read_long(&dest, &memlen);
 	}
 	if (res == 0) {
-		res = read_memstate(&dest, val);
+		memstart = dest._pos;
+		res = read_undo_memstate(&dest);
+		dest._pos = memstart + memlen;
 	}
 	if (res == 0) {
 		res = read_long(&dest, &val);
@@ -208,13 +208,14 @@ uint Glulx::perform_restoreundo() {
 			res = heap_apply_summary(heapsumlen, heapsumarr);
 	}
 
+	if (res == 0) {
+		/* Step the delta base back to the state saved before this one. */
+		res = apply_undo_memstate(dest._ptr + memstart, memlen);
+	}
+
 	if (res == 0) {
 		/* It worked. */
-		if (undo_chain_size > 1)
-			memmove(undo_chain, undo_chain + 1,
-			        (undo_chain_size - 1) * sizeof(unsigned char *));
-		undo_chain_num -= 1;
-		glulx_free(dest._ptr);
+		undo_chain.pop();
 		dest._ptr = nullptr;
 	} else {
 		/* It didn't work. */
@@ -348,7 +349,7 @@ int Glulx::reposition_write(dest_t *dest, uint pos) {
 int Glulx::write_buffer(dest_t *dest, const byte *ptr, uint len) {
 	if (dest->_isMem) {
 		if (dest->_pos + len > dest->_size) {
-			dest->_size = dest->_pos + len + 1024;
+			dest->_size = MAX(dest->_pos + len, dest->_size * 2) + 1024;
 			if (!dest->_ptr) {
 				dest->_ptr = (byte *)glulx_malloc(dest->_size);
 			} else {
@@ -556,6 +557,164 @@ uint Glulx::read_memstate(dest_t *dest, uint chunklen) {
 	return 0;
 }
 
+uint Glulx::write_undo_memstate(dest_t *dest) {
+	uint res, pos, len, common;
+	int val;
+	int runlen;
+	unsigned char ch;
+
+	if (!undo_ram) {
+		/* The first delta is taken against RAM as it is in the game file,
+		   just like the on-disk format. */
+		len = endgamefile - ramstart;
+		undo_ram = (byte *)glulx_malloc(MAX<uint>(len, 1));
+		if (!undo_ram)
+			return 1;
+#ifdef SERIALIZE_CACHE_RAM
+		memcpy(undo_ram, ramcache, len);
+#else /* SERIALIZE_CACHE_RAM */
+		_gameFile.seek(gamefile_start + ramstart);
+		if (_gameFile.read(undo_ram, len) != len)
+			fatal_error("The game file ended unexpectedly while saving.");
+#endif /* SERIALIZE_CACHE_RAM */
+		undo_ramend = endgamefile;
+	}
+
+	/* Store both sizes: the current one to restore this state, the
+	   previous one to step undo_ram back afterwards. */
+	res = write_long(dest, endmem);
+	if (res)
+		return res;
+	res = write_long(dest, undo_ramend);
+	if (res)
+		return res;
+
+	len = MAX(endmem, undo_ramend);
+	common = MIN(endmem, undo_ramend);
+	runlen = 0;
+
+	for (pos = ramstart; pos < len;) {
+		/* Most of RAM doesn't change from one turn to the next. */
+		if (pos + UNDO_BLOCK <= common
+		        && !memcmp(memmap + pos, undo_ram + (pos - ramstart), UNDO_BLOCK)) {
+			runlen += UNDO_BLOCK;
+			pos += UNDO_BLOCK;
+			continue;
+		}
+
+		ch = (pos < endmem) ? Mem1(pos) : 0;
+		if (pos < undo_ramend)
+			ch ^= undo_ram[pos - ramstart];
+		pos++;
+
+		if (ch == 0) {
+			runlen++;
+		} else {
+			/* Write any run we've got. */
+			while (runlen) {
+				if (runlen >= 0x100)
+					val = 0x100;
+				else
+					val = runlen;
+				res = write_byte(dest, 0);
+				if (res)
+					return res;
+				res = write_byte(dest, (val - 1));
+				if (res)
+					return res;
+				runlen -= val;
+			}
+			/* Write the byte we got. */
+			res = write_byte(dest, ch);
+			if (res)
+				return res;
+		}
+	}
+	/* It's possible we've got a run left over, but we don't write it. */
+
+	return 0;
+}
+
+uint Glulx::update_undo_ram() {
+	uint len = endmem - ramstart;
+	byte *ram = (byte *)glulx_realloc(undo_ram, MAX<uint>(len, 1));
+	if (!ram)
+		return 1;
+
+	memcpy(ram, memmap + ramstart, len);
+	undo_ram = ram;
+	undo_ramend = endmem;
+	return 0;
+}
+
+uint Glulx::read_undo_memstate(dest_t *dest) {
+	uint res, newlen, pos, end;
+
+	heap_clear();
+
+	res = read_long(dest, &newlen);
+	if (res)
+		return res;
+
+	res = change_memsize(newlen, false);
+	if (res)
+		return res;
+
+	/* undo_ram holds exactly the state being restored, so it's copied
+	   as it is; the delta itself is only needed to step undo_ram back. */
+	for (pos = ramstart; pos < endmem; pos = end) {
+		if (pos >= protectstart && pos < protectend) {
+			end = MIN(protectend, endmem);
+			continue;
+		}
+
+		end = (pos < protectstart) ? MIN(protectstart, endmem) : endmem;
+		if (pos < undo_ramend) {
+			uint copyend = MIN(end, undo_ramend);
+			memcpy(memmap + pos, undo_ram + (pos - ramstart), copyend - pos);
+			if (copyend < end)
+				memset(memmap + copyend, 0, end - copyend);
+		} else {
+			memset(memmap + pos, 0, end - pos);
+		}
+	}
+
+	return 0;
+}
+
+uint Glulx::apply_undo_memstate(const byte *ptr, uint chunklen) {
+	const byte *chunkend = ptr + chunklen;
+	uint curend = Read4(ptr);
+	uint prevend = Read4(ptr + 4);
+	uint len = MAX(curend, prevend) - ramstart;
+	uint pos, runlen;
+	byte *ram;
+
+	ptr += 8;
+
+	ram = (byte *)glulx_realloc(undo_ram, MAX<uint>(len, 1));
+	if (!ram)
+		return 1;
+	if (undo_ramend - ramstart < len)
+		memset(ram + (undo_ramend - ramstart), 0, len - (undo_ramend - ramstart));
+	undo_ram = ram;
+
+	runlen = 0;
+	for (pos = 0; pos < len && ptr < chunkend; pos++) {
+		if (runlen) {
+			runlen--;
+		} else if (*ptr == 0) {
+			runlen = ptr[1];
+			ptr += 2;
+		} else {
+			ram[pos] ^= *ptr++;
+		}
+	}
+
+	undo_ramend = prevend;
+	return 0;
+}
+
 uint Glulx::write_heapstate(dest_t *dest, int portable) {
 	uint res;
 	uint sumlen;
@@ -0,0 +1,92 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "glk/glulx/undo_chain.h"
+#include "common/endian.h"
+
+namespace Glk {
+namespace Glulx {
+
+bool UndoChain::init(int size) {
+	clear();
+	if (size == 0)
+		return true;
+
+	_entries = (byte **)malloc(sizeof(byte *) * size);
+	if (!_entries)
+		return false;
+
+	_size = size;
+	return true;
+}
+
+void UndoChain::clear() {
+	for (int ix = 0; ix < _count; ix++)
+		free(_entries[ix]);
+	free(_entries);
+
+	_entries = nullptr;
+	_size = 0;
+	_count = 0;
+	_bytes = 0;
+}
+
+void UndoChain::push(byte *entry, uint maxBytes) {
+	assert(_size > 0);
+
+	if (_count >= _size) {
+		_count -= 1;
+		_bytes -= entrySize(_entries[_count]);
+		free(_entries[_count]);
+	}
+	memmove(_entries + 1, _entries, _count * sizeof(byte *));
+	_entries[0] = entry;
+	_bytes += entrySize(entry);
+	_count += 1;
+
+	/* Drop the oldest states once the chain gets too big. Restoring
+	   only ever goes back from the newest state, so the deltas of the
+	   remaining ones stay valid. */
+	while (_count > 1 && _bytes > maxBytes) {
+		_count -= 1;
+		_bytes -= entrySize(_entries[_count]);
+		free(_entries[_count]);
+	}
+}
+
+void UndoChain::pop() {
+	assert(_count > 0);
+
+	_bytes -= entrySize(_entries[0]);
+	free(_entries[0]);
+	_count -= 1;
+	memmove(_entries, _entries + 1, _count * sizeof(byte *));
+}
+
+uint UndoChain::entrySize(const byte *entry) {
+	uint memlen = READ_BE_UINT32(entry);
+	uint heaplen = READ_BE_UINT32(entry + 4 + memlen);
+	uint stacklen = READ_BE_UINT32(entry + 8 + memlen + heaplen);
+	return 12 + memlen + heaplen + stacklen;
+}
+
+} // End of namespace Glulx
+} // End of namespace Glk
@@ -0,0 +1,95 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GLK_GLULXE_UNDO_CHAIN
+#define GLK_GLULXE_UNDO_CHAIN
+
+#include "common/scummsys.h"
+
+namespace Glk {
+namespace Glulx {
+
+/**
+ * The saved undo states, newest first, along with the total number of bytes they use.
+ * Each entry is a malloc'ed block holding a memory, heap and stack chunk, each preceded
+ * by its length as a big-endian 32-bit value.
+ */
+class UndoChain {
+private:
+	byte **_entries;
+	int _size;
+	int _count;
+	uint _bytes;
+public:
+	UndoChain() : _entries(nullptr), _size(0), _count(0), _bytes(0) {}
+	~UndoChain() { clear(); }
+
+	/**
+	 * Allocates room for up to size states, discarding any existing ones
+	 */
+	bool init(int size);
+
+	/**
+	 * Frees all the states and the chain itself
+	 */
+	void clear();
+
+	/**
+	 * Adds a new newest state, taking ownership of it. Once the chain is full, or uses more
+	 * than maxBytes, the oldest states are dropped; the newest one is always kept.
+	 */
+	void push(byte *entry, uint maxBytes);
+
+	/**
+	 * Removes and frees the newest state
+	 */
+	void pop();
+
+	/**
+	 * Returns the newest state, or nullptr if there are none
+	 */
+	byte *newest() const { return _count ? _entries[0] : nullptr; }
+
+	/**
+	 * Returns the maximum number of states the chain can hold
+	 */
+	int size() const { return _size; }
+
+	/**
+	 * Returns the number of states currently held
+	 */
+	int count() const { return _count; }
+
+	/**
+	 * Returns the total size of the states currently held
+	 */
+	uint bytes() const { return _bytes; }
+
+	/**
+	 * Returns the total size of a single state, including its length fields
+	 */
+	static uint entrySize(const byte *entry);
+};
+
+} // End of namespace Glulx
+} // End of namespace Glk
+
+#endif
@@ -114,6 +114,10 @@ void Glulx::finalize_vm() {
 		glulx_free(stack);
 		stack = nullptr;
 	}
+	if (opcache) {
+		glulx_free(opcache);
+		opcache = nullptr;
+	}
 
 	final_serial();
 }
@@ -189,6 +189,7 @@ MODULE_OBJS := \
 	glulx/search.o \
 	glulx/serial.o \
 	glulx/string.o \
+	glulx/undo_chain.o \
 	glulx/vm.o \
 	hugo/heexpr.o \
 	hugo/heglk.o \
@@ -130,54 +130,45 @@ void TextBufferWindow::reflow() {
 
 	_lines[0]._len = _numChars;
 
-	// allocate temp buffers
-	Attributes *attrbuf = new Attributes[SCROLLBACK * TBLINELEN];
-	uint32 *charbuf = new uint32[SCROLLBACK * TBLINELEN];
-	int *alignbuf = new int[SCROLLBACK];
-	Picture **pictbuf = new Picture *[SCROLLBACK];
-	uint *hyperbuf = new uint[SCROLLBACK];
-	int *offsetbuf = new int[SCROLLBACK];
-
-	if (!attrbuf || !charbuf || !alignbuf || !pictbuf || !hyperbuf || !offsetbuf) {
-		delete[] attrbuf;
-		delete[] charbuf;
-		delete[] alignbuf;
-		delete[] pictbuf;
-		delete[] hyperbuf;
-		delete[] offsetbuf;
-		return;
-	}
-
-	// copy text to temp buffers
+	// copy text to temp buffers, sized for the text actually present
+	// rather than for a completely full scrollback
 
 	oldattr = _attr;
 	curattr.clear();
 
-	x = 0;
-	p = 0;
 	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
 
+	uint numChars = 0;
+	for (k = s; k >= 0; k--)
+		numChars += _lines[k]._len + (_lines[k]._newLine ? 1 : 0);
+
+	Common::Array<Attributes> attrbuf(numChars);
+	Common::Array<uint32> charbuf(numChars);
+	Common::Array<int> alignbuf;
+	Common::Array<Picture *> pictbuf;
+	Common::Array<uint> hyperbuf;
+	Common::Array<int> offsetbuf;
+
+	p = 0;
+
 	for (k = s; k >= 0; k--) {
 		if (k == 0 && _lineRequest)
 			inputbyte = p + _inFence;
 
 		if (_lines[k]._lPic) {
-			offsetbuf[x] = p;
-			alignbuf[x] = imagealign_MarginLeft;
-			pictbuf[x] = _lines[k]._lPic;
-
-			if (pictbuf[x]) pictbuf[x]->increment();
-			hyperbuf[x] = _lines[k]._lHyper;
-			x++;
+			offsetbuf.push_back(p);
+			alignbuf.push_back(imagealign_MarginLeft);
+			pictbuf.push_back(_lines[k]._lPic);
+			pictbuf.back()->increment();
+			hyperbuf.push_back(_lines[k]._lHyper);
 		}
 
 		if (_lines[k]._rPic) {
-			offsetbuf[x] = p;
-			alignbuf[x] = imagealign_MarginRight;
-			pictbuf[x] = _lines[k]._rPic;
-			if (pictbuf[x]) pictbuf[x]->increment();
-			hyperbuf[x] = _lines[k]._rHyper;
-			x++;
+			offsetbuf.push_back(p);
+			alignbuf.push_back(imagealign_MarginRight);
+			pictbuf.push_back(_lines[k]._rPic);
+			pictbuf.back()->increment();
+			hyperbuf.push_back(_lines[k]._rHyper);
 		}
 
 		for (i = 0; i < _lines[k]._len; i++) {
@@ -193,7 +184,7 @@ void TextBufferWindow::reflow() {
 		}
 	}
 
-	offsetbuf[x] = -1;
+	offsetbuf.push_back(-1);
 
 	// clear window
 	clear();
@@ -219,18 +210,10 @@ void TextBufferWindow::reflow() {
 
 	if (inputbyte != -1) {
 		_inFence = _numChars;
-		putTextUni(charbuf + inputbyte, p - inputbyte, _numChars, 0);
+		putTextUni(charbuf.data() + inputbyte, p - inputbyte, _numChars, 0);
 		_inCurs = _numChars;
 	}
 
-	// free temp buffers
-	delete[] attrbuf;
-	delete[] charbuf;
-	delete[] alignbuf;
-	delete[] pictbuf;
-	delete[] hyperbuf;
-	delete[] offsetbuf;
-
 	_attr = oldattr;
 
 	touchScroll();
@@ -1087,7 +1070,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1531,8 +1514,15 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_scrollMax++;
 
 	if (_scrollMax > _scrollBack - 1
-			|| _lastSeen > _scrollBack - 1)
-		scrollResize();
+			|| _lastSeen > _scrollBack - 1) {
+		if (!g_conf->_scrollBack || _scrollBack < g_conf->_scrollBack) {
+			scrollResize();
+		} else {
+			// Scrollback is full, so the oldest line is dropped
+			_scrollMax = MIN(_scrollMax, _scrollBack - 1);
+			_lastSeen = MIN(_lastSeen, _scrollBack - 1);
+		}
+	}
 
 	if (_lastSeen >= _height)
 		_scrollPos++;
@@ -1549,11 +1539,20 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// Recycle the oldest row as the new line 0
+	bool repaint = _lines[0]._repaint;
+	_lines.rotate();
+	_lines[0]._repaint = repaint;
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
+
+	if (_lines[0]._lPic)
+		_lines[0]._lPic->decrement();
+	if (_lines[0]._rPic)
+		_lines[0]._rPic->decrement();
+
+	for (int i = MIN(_height, _scrollBack) - 1; i > 0; i--)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1588,12 +1587,17 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 void TextBufferWindow::scrollResize() {
 	int i;
 
-	_lines.resize(_scrollBack + SCROLLBACK);
+	// Grow in SCROLLBACK steps, but stop exactly at the configured limit
+	int newSize = _scrollBack + SCROLLBACK;
+	if (g_conf->_scrollBack)
+		newSize = MIN(newSize, g_conf->_scrollBack);
+
+	_lines.resize(newSize);
 
 	_chars = _lines[0]._chars;
 	_attrs = _lines[0]._attrs;
 
-	for (i = _scrollBack; i < (_scrollBack + SCROLLBACK); i++) {
+	for (i = _scrollBack; i < newSize; i++) {
 		_lines[i]._dirty = false;
 		_lines[i]._repaint = false;
 		_lines[i]._lm = 0;
@@ -1608,7 +1612,21 @@ void TextBufferWindow::scrollResize() {
 		_lines[i]._attrs->clear();
 	}
 
-	_scrollBack += SCROLLBACK;
+	_scrollBack = newSize;
+}
+
+void TextBufferWindow::TextBufferRows::resize(uint newSize) {
+	if (_first) {
+		// Unwrap the ring so that the rows are back in order
+		Common::Array<TextBufferRow> rows;
+		rows.reserve(MAX(newSize, _rows.size()));
+		for (uint i = 0; i < _rows.size(); i++)
+			rows.push_back(_rows[(_first + i) % _rows.size()]);
+		_rows.swap(rows);
+		_first = 0;
+	}
+
+	_rows.resize(newSize);
 }
 
 int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numChars, int spw) {
@@ -52,7 +52,40 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * Scrollback rows, kept as a ring so that scrolling in a new line
+	 * recycles the oldest row rather than moving every row down by one
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _first;
+	public:
+		/**
+		 * Constructor
+		 */
+		TextBufferRows() : _first(0) {}
+
+		TextBufferRow &operator[](int idx) {
+			uint pos = _first + idx;
+			return _rows[pos < _rows.size() ? pos : pos - _rows.size()];
+		}
+
+		uint size() const { return _rows.size(); }
+
+		/**
+		 * Resize the scrollback, keeping the existing rows in order
+		 */
+		void resize(uint newSize);
+
+		/**
+		 * Turns the oldest row into row 0, shifting all others up by one
+		 */
+		void rotate() {
+			_first = (_first == 0 ? _rows.size() : _first) - 1;
+		}
+	};
 private:
 	PropFontInfo &_font;
 private:
@@ -368,6 +368,8 @@ void NewtonWorldCriticalSectionUnlock(NewtonWorld *const newtonWorld) {
 //
 // Remarks: the function is only only have effect on the multi core version of the engine.
 //
+// Remarks: ScummVM has no threads for engines to use, so the engine always runs on a single thread.
+//
 // See also: NewtonGetThreadNumber, NewtonGetThreadsCount
 void NewtonSetThreadsCount(NewtonWorld *const newtonWorld, int threads) {
 	TRACE_FUNTION(__FUNCTION__);
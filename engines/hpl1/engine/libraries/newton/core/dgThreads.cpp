@@ -28,16 +28,8 @@ inline void dgSpinUnlock(dgInt32 *spin) {
 }
 
 dgThreads::dgThreads() {
-	m_numberOfCPUCores = 0;
-
 	m_numOfThreads = 0;
-	m_exit = false;
-
-	m_topIndex = 0;
-	m_bottomIndex = 0;
-	m_workInProgress = 0;
 	m_globalSpinLock = 0;
-	m_workToDoSpinLock = 0;
 
 	m_getPerformanceCount = NULL;
 	for (dgInt32 i = 0; i < DG_MAXIMUN_THREADS; i++) {
@@ -73,40 +65,23 @@ dgUnsigned32 dgThreads::GetPerfomanceTicks(dgUnsigned32 threadIndex) const {
 }
 
 void dgThreads::CreateThreaded(dgInt32 threads) {
-
+	// No worker threads can be created, see dgThreads.h
+	m_numOfThreads = 0;
 }
 
 void dgThreads::DestroydgThreads() {
-
+	m_numOfThreads = 0;
 }
 
-//Queues up another to work
+// Runs the job right away on the calling thread
 dgInt32 dgThreads::SubmitJob(dgWorkerThread *const job) {
 	NEWTON_ASSERT(job->m_threadIndex != -1);
 	job->ThreadExecute();
 	return 1;
 }
 
-void *dgThreads::ThreadExecute(void *param) {
-	dgLocadData &data = *(dgLocadData *) param;
-	data.m_manager->DoWork(data.m_threadIndex);
-	return 0;
-}
-
-dgInt32 dgThreads::GetWork(dgWorkerThread **job) {
-	dgWorkerThread *cWorker = m_queue[m_bottomIndex];
-	*job = cWorker;
-	return 1;
-}
-
-void dgThreads::DoWork(dgInt32 mythreadIndex) {
-//	dgWorkerThread *job;
-
-//	job->ThreadExecute();
-}
-
 void dgThreads::SynchronizationBarrier() {
-
+	// All submitted jobs have already run
 }
 
 void dgThreads::CalculateChunkSizes(dgInt32 elements,
@@ -22,8 +22,11 @@
 #if !defined(AFX_DG_THREADS_42YH_HY78GT_YHJ63Y__INCLUDED_)
 #define AFX_DG_THREADS_42YH_HY78GT_YHJ63Y__INCLUDED_
 
-#define DG_MAXQUEUE     16
-
+// ScummVM does not let engines create threads, so the thread manager runs
+// every job on the calling thread, in the order the jobs are submitted. The
+// world always reports a single thread, which makes the solver and the
+// collision passes take their single threaded paths and keeps the results
+// deterministic.
 
 class dgWorkerThread {
 public:
@@ -67,27 +70,9 @@ private:
 		dgThreads *m_manager;
 	};
 
-	void DoWork(dgInt32 threadIndex);
-	dgInt32 GetWork(dgWorkerThread **cWork);
-
-
-	static void *ThreadExecute(void *Param);
-
 	dgInt32 m_numOfThreads;
-	dgInt32 m_numberOfCPUCores;
-	dgInt32 m_topIndex;
-	dgInt32 m_bottomIndex;
-	dgInt32 m_workInProgress;
 	mutable dgInt32 m_globalSpinLock;
 
-	bool m_exit;
-	//dgInt32 m_emptySlot;
-	//dgInt32 m_workToDo;
-	//dgInt32 m_criticalSection;
-	dgInt32 m_workToDoSpinLock;
-	dgWorkerThread *m_queue[DG_MAXQUEUE];
-	//pthread_t m_threadhandles[DG_MAXIMUN_THREADS];
-
 	OnGetPerformanceCountCallback m_getPerformanceCount;
 	dgLocadData m_localData[DG_MAXIMUN_THREADS];
 };
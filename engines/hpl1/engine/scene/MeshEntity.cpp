@@ -97,6 +97,7 @@ cMeshEntity::cMeshEntity(const tString asName, cMesh *apMesh, cMaterialManager *
 	mbSkeletonColliders = false;
 
 	mbUpdatedBones = false;
+	mlBoneMatricesCount = 0;
 
 	mlStartSleepCount = 0;
 	mlUpdateCount = 0;
@@ -321,7 +322,7 @@ cMeshEntity::cMeshEntity(const tString asName, cMesh *apMesh, cMaterialManager *
 		}
 
 		// Create an array to fill with bone matrices
-		mvBoneMatrices.resize(pSkeleton->GetBoneNum());
+		mvBoneMatrices.resize(pSkeleton->GetBoneNum(), cMatrixf::Identity);
 
 		// Reset all bones states
 		for (size_t i = 0; i < mvBoneStates.size(); i++) {
@@ -1135,6 +1136,7 @@ void cMeshEntity::UpdateGraphics(cCamera3D *apCamera, float afFrameTime, cRender
 			mpRootNode->SetMatrix(cMatrixf::Identity);
 		}*/
 		cMatrixf *pInvWorldMtx = GetInvModelMatrix();
+		bool bChanged = false;
 
 		for (int i = 0; i < pSkeleton->GetBoneNum(); i++) {
 			cBone *pBone = pSkeleton->GetBoneByIndex(i);
@@ -1143,10 +1145,18 @@ void cMeshEntity::UpdateGraphics(cCamera3D *apCamera, float afFrameTime, cRender
 			// Transform the movement of the bone into the
 			// Bind pose's local space.
 			cMatrixf mtxLocal = cMath::MatrixMul(*pInvWorldMtx, pState->GetWorldMatrix());
+			cMatrixf mtxBone = cMath::MatrixMul(mtxLocal, pBone->GetInvWorldTransform());
 
-			mvBoneMatrices[i] = cMath::MatrixMul(mtxLocal, pBone->GetInvWorldTransform());
+			if (memcmp(mvBoneMatrices[i].v, mtxBone.v, sizeof(mtxBone.v)) != 0) {
+				mvBoneMatrices[i] = mtxBone;
+				bChanged = true;
+			}
 		}
 
+		// Let the sub meshes know that they need to be skinned again
+		if (bChanged)
+			++mlBoneMatricesCount;
+
 		// Set back the matrix.
 		/*if(mpRootNode){
 			mpRootNode->SetMatrix(mtxTemp);
@@ -242,6 +242,7 @@ private:
 	tNodeStateVec mvTempBoneStates;
 
 	Common::Array<cMatrixf> mvBoneMatrices;
+	int mlBoneMatricesCount;
 
 	bool mbSkeletonPhysics;
 	bool mbSkeletonPhysicsFading;
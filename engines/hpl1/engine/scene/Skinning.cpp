@@ -0,0 +1,101 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "hpl1/engine/scene/Skinning.h"
+#include "common/system.h"
+
+namespace hpl {
+
+cSkinning::tSkinVerticesFunc cSkinning::skinVertices = nullptr;
+
+//-----------------------------------------------------------------------
+
+void cSkinning::SkinVertices(const cSkinningData &aData) {
+	if (!skinVertices) {
+		skinVertices = SkinVerticesGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			skinVertices = SkinVerticesNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			skinVertices = SkinVerticesSSE2;
+#endif
+	}
+
+	skinVertices(aData);
+}
+
+//-----------------------------------------------------------------------
+
+void cSkinning::SkinVerticesGeneric(const cSkinningData &aData) {
+	const float *pBindPos = aData.mpBindPos;
+	const float *pBindNormal = aData.mpBindNormal;
+	const float *pBindTangent = aData.mpBindTangent;
+
+	float *pSkinPos = aData.mpSkinPos;
+	float *pSkinNormal = aData.mpSkinNormal;
+	float *pSkinTangent = aData.mpSkinTangent;
+
+	for (int vtx = 0; vtx < aData.mlVtxNum; vtx++) {
+		const float *pWeight = &aData.mpWeights[vtx * 4];
+		const unsigned char *pBoneIdx = &aData.mpBones[vtx * 4];
+
+		if (pWeight[0] != 0) {
+			// Blend the upper 3x4 part of the bone matrices
+			float m[12];
+			const float *pMtx = aData.mpBoneMatrices[pBoneIdx[0]].v;
+			for (int i = 0; i < 12; i++)
+				m[i] = pMtx[i] * pWeight[0];
+
+			for (int lCount = 1; lCount < 4 && pWeight[lCount] != 0; lCount++) {
+				pMtx = aData.mpBoneMatrices[pBoneIdx[lCount]].v;
+				for (int i = 0; i < 12; i++)
+					m[i] += pMtx[i] * pWeight[lCount];
+			}
+
+			pSkinPos[0] = m[0] * pBindPos[0] + m[1] * pBindPos[1] + m[2] * pBindPos[2] + m[3];
+			pSkinPos[1] = m[4] * pBindPos[0] + m[5] * pBindPos[1] + m[6] * pBindPos[2] + m[7];
+			pSkinPos[2] = m[8] * pBindPos[0] + m[9] * pBindPos[1] + m[10] * pBindPos[2] + m[11];
+
+			pSkinNormal[0] = m[0] * pBindNormal[0] + m[1] * pBindNormal[1] + m[2] * pBindNormal[2];
+			pSkinNormal[1] = m[4] * pBindNormal[0] + m[5] * pBindNormal[1] + m[6] * pBindNormal[2];
+			pSkinNormal[2] = m[8] * pBindNormal[0] + m[9] * pBindNormal[1] + m[10] * pBindNormal[2];
+
+			pSkinTangent[0] = m[0] * pBindTangent[0] + m[1] * pBindTangent[1] + m[2] * pBindTangent[2];
+			pSkinTangent[1] = m[4] * pBindTangent[0] + m[5] * pBindTangent[1] + m[6] * pBindTangent[2];
+			pSkinTangent[2] = m[8] * pBindTangent[0] + m[9] * pBindTangent[1] + m[10] * pBindTangent[2];
+		}
+
+		pBindPos += aData.mlPosStride;
+		pSkinPos += aData.mlPosStride;
+
+		pBindNormal += 3;
+		pSkinNormal += 3;
+
+		pBindTangent += 4;
+		pSkinTangent += 4;
+	}
+}
+
+//-----------------------------------------------------------------------
+
+} // namespace hpl
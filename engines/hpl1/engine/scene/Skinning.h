@@ -0,0 +1,80 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef HPL_SKINNING_H
+#define HPL_SKINNING_H
+
+#include "hpl1/engine/math/MathTypes.h"
+
+namespace hpl {
+
+/**
+ * Input and output arrays of a CPU skinning pass.
+ *
+ * Every vertex has four weights and four bone indices. The weights are
+ * sorted so that the first zero weight ends the list of influences, and a
+ * vertex whose first weight is zero is left untouched.
+ *
+ * Only the xyz components of the positions, normals and tangents are
+ * written, the w components of the skinned arrays keep their values.
+ */
+struct cSkinningData {
+	const cMatrixf *mpBoneMatrices;
+	const float *mpWeights;
+	const unsigned char *mpBones;
+
+	const float *mpBindPos;
+	const float *mpBindNormal;
+	const float *mpBindTangent;
+
+	float *mpSkinPos;
+	float *mpSkinNormal;
+	float *mpSkinTangent;
+
+	int mlPosStride;
+	int mlVtxNum;
+};
+
+class cSkinning {
+public:
+	typedef void (*tSkinVerticesFunc)(const cSkinningData &aData);
+
+	/**
+	 * Skins all vertices. The weighted bone matrices of a vertex are
+	 * blended first and the result is applied once to the position,
+	 * normal and tangent.
+	 */
+	static void SkinVertices(const cSkinningData &aData);
+
+	static tSkinVerticesFunc skinVertices;
+
+	static void SkinVerticesGeneric(const cSkinningData &aData);
+#ifdef SCUMMVM_SSE2
+	static void SkinVerticesSSE2(const cSkinningData &aData);
+#endif
+#ifdef SCUMMVM_NEON
+	static void SkinVerticesNEON(const cSkinningData &aData);
+#endif
+};
+
+} // namespace hpl
+
+#endif // HPL_SKINNING_H
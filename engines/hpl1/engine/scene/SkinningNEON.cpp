@@ -0,0 +1,119 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "hpl1/engine/scene/Skinning.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace hpl {
+
+static inline float32x4_t transformVec(float32x4_t c0, float32x4_t c1, float32x4_t c2, const float *pSrc) {
+	float32x4_t res = vmulq_n_f32(c0, pSrc[0]);
+	res = vmlaq_n_f32(res, c1, pSrc[1]);
+	return vmlaq_n_f32(res, c2, pSrc[2]);
+}
+
+static inline void storeVec3(float *pDest, float32x4_t v) {
+	vst1_f32(pDest, vget_low_f32(v));
+	vst1q_lane_f32(pDest + 2, v, 2);
+}
+
+void cSkinning::SkinVerticesNEON(const cSkinningData &aData) {
+	const float *pBindPos = aData.mpBindPos;
+	const float *pBindNormal = aData.mpBindNormal;
+	const float *pBindTangent = aData.mpBindTangent;
+
+	float *pSkinPos = aData.mpSkinPos;
+	float *pSkinNormal = aData.mpSkinNormal;
+	float *pSkinTangent = aData.mpSkinTangent;
+
+	for (int vtx = 0; vtx < aData.mlVtxNum; vtx++) {
+		const float *pWeight = &aData.mpWeights[vtx * 4];
+		const unsigned char *pBoneIdx = &aData.mpBones[vtx * 4];
+
+		if (pWeight[0] != 0) {
+			// Blend the rows of the bone matrices
+			const float *pMtx = aData.mpBoneMatrices[pBoneIdx[0]].v;
+			float32x4_t r0 = vmulq_n_f32(vld1q_f32(pMtx), pWeight[0]);
+			float32x4_t r1 = vmulq_n_f32(vld1q_f32(pMtx + 4), pWeight[0]);
+			float32x4_t r2 = vmulq_n_f32(vld1q_f32(pMtx + 8), pWeight[0]);
+
+			for (int lCount = 1; lCount < 4 && pWeight[lCount] != 0; lCount++) {
+				pMtx = aData.mpBoneMatrices[pBoneIdx[lCount]].v;
+				r0 = vmlaq_n_f32(r0, vld1q_f32(pMtx), pWeight[lCount]);
+				r1 = vmlaq_n_f32(r1, vld1q_f32(pMtx + 4), pWeight[lCount]);
+				r2 = vmlaq_n_f32(r2, vld1q_f32(pMtx + 8), pWeight[lCount]);
+			}
+
+			// Turn the rows into columns, c3 holds the translation
+			const float32x4x2_t t0 = vzipq_f32(r0, r2);
+			const float32x4x2_t t1 = vzipq_f32(r1, vdupq_n_f32(0.0f));
+			const float32x4x2_t lo = vzipq_f32(t0.val[0], t1.val[0]);
+			const float32x4x2_t hi = vzipq_f32(t0.val[1], t1.val[1]);
+			const float32x4_t c0 = lo.val[0];
+			const float32x4_t c1 = lo.val[1];
+			const float32x4_t c2 = hi.val[0];
+			const float32x4_t c3 = hi.val[1];
+
+			storeVec3(pSkinPos, vaddq_f32(transformVec(c0, c1, c2, pBindPos), c3));
+			storeVec3(pSkinNormal, transformVec(c0, c1, c2, pBindNormal));
+			storeVec3(pSkinTangent, transformVec(c0, c1, c2, pBindTangent));
+		}
+
+		pBindPos += aData.mlPosStride;
+		pSkinPos += aData.mlPosStride;
+
+		pBindNormal += 3;
+		pSkinNormal += 3;
+
+		pBindTangent += 4;
+		pSkinTangent += 4;
+	}
+}
+
+} // namespace hpl
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,109 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "hpl1/engine/scene/Skinning.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace hpl {
+
+static inline __m128 transformVec(__m128 c0, __m128 c1, __m128 c2, const float *pSrc) {
+	__m128 res = _mm_mul_ps(c0, _mm_set1_ps(pSrc[0]));
+	res = _mm_add_ps(res, _mm_mul_ps(c1, _mm_set1_ps(pSrc[1])));
+	return _mm_add_ps(res, _mm_mul_ps(c2, _mm_set1_ps(pSrc[2])));
+}
+
+static inline void storeVec3(float *pDest, __m128 v) {
+	_mm_storel_pi((__m64 *)pDest, v);
+	_mm_store_ss(pDest + 2, _mm_movehl_ps(v, v));
+}
+
+void cSkinning::SkinVerticesSSE2(const cSkinningData &aData) {
+	const float *pBindPos = aData.mpBindPos;
+	const float *pBindNormal = aData.mpBindNormal;
+	const float *pBindTangent = aData.mpBindTangent;
+
+	float *pSkinPos = aData.mpSkinPos;
+	float *pSkinNormal = aData.mpSkinNormal;
+	float *pSkinTangent = aData.mpSkinTangent;
+
+	for (int vtx = 0; vtx < aData.mlVtxNum; vtx++) {
+		const float *pWeight = &aData.mpWeights[vtx * 4];
+		const unsigned char *pBoneIdx = &aData.mpBones[vtx * 4];
+
+		if (pWeight[0] != 0) {
+			// Blend the rows of the bone matrices
+			const float *pMtx = aData.mpBoneMatrices[pBoneIdx[0]].v;
+			__m128 w = _mm_set1_ps(pWeight[0]);
+			__m128 r0 = _mm_mul_ps(_mm_loadu_ps(pMtx), w);
+			__m128 r1 = _mm_mul_ps(_mm_loadu_ps(pMtx + 4), w);
+			__m128 r2 = _mm_mul_ps(_mm_loadu_ps(pMtx + 8), w);
+
+			for (int lCount = 1; lCount < 4 && pWeight[lCount] != 0; lCount++) {
+				pMtx = aData.mpBoneMatrices[pBoneIdx[lCount]].v;
+				w = _mm_set1_ps(pWeight[lCount]);
+				r0 = _mm_add_ps(r0, _mm_mul_ps(_mm_loadu_ps(pMtx), w));
+				r1 = _mm_add_ps(r1, _mm_mul_ps(_mm_loadu_ps(pMtx + 4), w));
+				r2 = _mm_add_ps(r2, _mm_mul_ps(_mm_loadu_ps(pMtx + 8), w));
+			}
+
+			// Turn the rows into columns, r3 ends up holding the translation
+			__m128 r3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			storeVec3(pSkinPos, _mm_add_ps(transformVec(r0, r1, r2, pBindPos), r3));
+			storeVec3(pSkinNormal, transformVec(r0, r1, r2, pBindNormal));
+			storeVec3(pSkinTangent, transformVec(r0, r1, r2, pBindTangent));
+		}
+
+		pBindPos += aData.mlPosStride;
+		pSkinPos += aData.mlPosStride;
+
+		pBindNormal += 3;
+		pSkinNormal += 3;
+
+		pBindTangent += 4;
+		pSkinTangent += 4;
+	}
+}
+
+} // namespace hpl
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
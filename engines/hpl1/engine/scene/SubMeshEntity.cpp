@@ -43,6 +43,7 @@
 
 #include "hpl1/engine/scene/AnimationState.h"
 #include "hpl1/engine/scene/NodeState.h"
+#include "hpl1/engine/scene/Skinning.h"
 
 #include "hpl1/engine/physics/PhysicsBody.h"
 
@@ -66,6 +67,7 @@ cSubMeshEntity::cSubMeshEntity(const tString &asName, cMeshEntity *apMeshEntity,
 	mbCastShadows = false;
 
 	mbGraphicsUpdated = false;
+	mlSkinnedBoneMatricesCount = -1;
 
 	mpBody = NULL;
 
@@ -148,113 +150,34 @@ iMaterial *cSubMeshEntity::GetMaterial() {
 
 //-----------------------------------------------------------------------
 
-// Set Src as private variable to give this a little boost! Or?
-static inline void MatrixFloatTransformSet(float *pDest, const cMatrixf &a_mtxA, const float *pSrc, const float fWeight) {
-	pDest[0] = (a_mtxA.m[0][0] * pSrc[0] + a_mtxA.m[0][1] * pSrc[1] + a_mtxA.m[0][2] * pSrc[2] + a_mtxA.m[0][3]) * fWeight;
-	pDest[1] = (a_mtxA.m[1][0] * pSrc[0] + a_mtxA.m[1][1] * pSrc[1] + a_mtxA.m[1][2] * pSrc[2] + a_mtxA.m[1][3]) * fWeight;
-	pDest[2] = (a_mtxA.m[2][0] * pSrc[0] + a_mtxA.m[2][1] * pSrc[1] + a_mtxA.m[2][2] * pSrc[2] + a_mtxA.m[2][3]) * fWeight;
-}
-
-static inline void MatrixFloatRotateSet(float *pDest, const cMatrixf &a_mtxA, const float *pSrc, const float fWeight) {
-	pDest[0] = (a_mtxA.m[0][0] * pSrc[0] + a_mtxA.m[0][1] * pSrc[1] + a_mtxA.m[0][2] * pSrc[2]) * fWeight;
-	pDest[1] = (a_mtxA.m[1][0] * pSrc[0] + a_mtxA.m[1][1] * pSrc[1] + a_mtxA.m[1][2] * pSrc[2]) * fWeight;
-	pDest[2] = (a_mtxA.m[2][0] * pSrc[0] + a_mtxA.m[2][1] * pSrc[1] + a_mtxA.m[2][2] * pSrc[2]) * fWeight;
-}
-
-////////////////////////////////////////////////////////////
-
-// Set Src as private variable to give this a little boost!Or?
-static inline void MatrixFloatTransformAdd(float *pDest, const cMatrixf &a_mtxA, const float *pSrc, const float fWeight) {
-	pDest[0] += (a_mtxA.m[0][0] * pSrc[0] + a_mtxA.m[0][1] * pSrc[1] + a_mtxA.m[0][2] * pSrc[2] + a_mtxA.m[0][3]) * fWeight;
-	pDest[1] += (a_mtxA.m[1][0] * pSrc[0] + a_mtxA.m[1][1] * pSrc[1] + a_mtxA.m[1][2] * pSrc[2] + a_mtxA.m[1][3]) * fWeight;
-	pDest[2] += (a_mtxA.m[2][0] * pSrc[0] + a_mtxA.m[2][1] * pSrc[1] + a_mtxA.m[2][2] * pSrc[2] + a_mtxA.m[2][3]) * fWeight;
-}
-
-static inline void MatrixFloatRotateAdd(float *pDest, const cMatrixf &a_mtxA, const float *pSrc, const float fWeight) {
-	pDest[0] += (a_mtxA.m[0][0] * pSrc[0] + a_mtxA.m[0][1] * pSrc[1] + a_mtxA.m[0][2] * pSrc[2]) * fWeight;
-	pDest[1] += (a_mtxA.m[1][0] * pSrc[0] + a_mtxA.m[1][1] * pSrc[1] + a_mtxA.m[1][2] * pSrc[2]) * fWeight;
-	pDest[2] += (a_mtxA.m[2][0] * pSrc[0] + a_mtxA.m[2][1] * pSrc[1] + a_mtxA.m[2][2] * pSrc[2]) * fWeight;
-}
-
-////////////////////////////////////////////////////////////
-
 void cSubMeshEntity::UpdateGraphics(cCamera3D *apCamera, float afFrameTime, cRenderList *apRenderList) {
 	if (mpDynVtxBuffer) {
-		if (mpMeshEntity->mbSkeletonPhysicsSleeping && mbGraphicsUpdated) {
+		// Nothing to do if the bones have not moved since the last skinning
+		if (mbGraphicsUpdated && (mpMeshEntity->mbSkeletonPhysicsSleeping ||
+								  mlSkinnedBoneMatricesCount == mpMeshEntity->mlBoneMatricesCount)) {
 			return;
 		}
 
 		mbGraphicsUpdated = true;
-
-		const float *pBindPos = mpSubMesh->GetVertexBuffer()->GetArray(eVertexFlag_Position);
-		const float *pBindNormal = mpSubMesh->GetVertexBuffer()->GetArray(eVertexFlag_Normal);
-		const float *pBindTangent = mpSubMesh->GetVertexBuffer()->GetArray(eVertexFlag_Texture1);
-
-		float *pSkinPos = mpDynVtxBuffer->GetArray(eVertexFlag_Position);
-		float *pSkinNormal = mpDynVtxBuffer->GetArray(eVertexFlag_Normal);
-		float *pSkinTangent = mpDynVtxBuffer->GetArray(eVertexFlag_Texture1);
+		mlSkinnedBoneMatricesCount = mpMeshEntity->mlBoneMatricesCount;
 
 		const int lVtxStride = kvVertexElements[cMath::Log2ToInt(eVertexFlag_Position)];
 		const int lVtxNum = mpDynVtxBuffer->GetVertexNum();
 
-		for (int vtx = 0; vtx < lVtxNum; vtx++) {
-			// To count the bone bindings
-			int lCount = 0;
-			// Get pointer to weights and bone index.
-			const float *pWeight = &mpSubMesh->mpVertexWeights[vtx * 4];
-			if (*pWeight == 0)
-				continue;
-
-			const unsigned char *pBoneIdx = &mpSubMesh->mpVertexBones[vtx * 4];
-
-			{
-				const cMatrixf &mtxTransform = mpMeshEntity->mvBoneMatrices[*pBoneIdx];
-
-				// Log("Vtx: %d\n",vtx);
-				// Log("Boneidx: %d Count %d Weight: %f vtx: %d\n",(int)*pBoneIdx,lCount, *pWeight,vtx);
-
-				// ATTENTION: Some optimizing might be done by accumulating the matrix instead.
-				// THIS is really unsure since it seems like it will result in more math, matrix mul = 8*4 calc
-				// Vertex mul with matrix is 3 * 3 calculations
-				// this means: vertex= 9*3 = 27, matrix = 32
-
-				MatrixFloatTransformSet(pSkinPos, mtxTransform, pBindPos, *pWeight);
-
-				MatrixFloatRotateSet(pSkinNormal, mtxTransform, pBindNormal, *pWeight);
-
-				MatrixFloatRotateSet(pSkinTangent, mtxTransform, pBindTangent, *pWeight);
-
-				++pWeight;
-				++pBoneIdx;
-				++lCount;
-			}
-
-			// Iterate weights until 0 is found or count < 4
-			while (*pWeight != 0 && lCount < 4) {
-				// Log("Boneidx: %d Count %d Weight: %f\n",(int)*pBoneIdx,lCount, *pWeight);
-				const cMatrixf &mtxTransform = mpMeshEntity->mvBoneMatrices[*pBoneIdx];
-
-				// Transform with the local movement of the bone.
-				MatrixFloatTransformAdd(pSkinPos, mtxTransform, pBindPos, *pWeight);
-
-				MatrixFloatRotateAdd(pSkinNormal, mtxTransform, pBindNormal, *pWeight);
-
-				MatrixFloatRotateAdd(pSkinTangent, mtxTransform, pBindTangent, *pWeight);
-
-				++pWeight;
-				++pBoneIdx;
-				++lCount;
-			}
-
-			pBindPos += lVtxStride;
-			pSkinPos += lVtxStride;
-
-			pBindNormal += 3;
-			pSkinNormal += 3;
-
-			pBindTangent += 4;
-			pSkinTangent += 4;
-		}
+		cSkinningData skinData;
+		skinData.mpBoneMatrices = &mpMeshEntity->mvBoneMatrices[0];
+		skinData.mpWeights = mpSubMesh->mpVertexWeights;
+		skinData.mpBones = mpSubMesh->mpVertexBones;
+		skinData.mpBindPos = mpSubMesh->GetVertexBuffer()->GetArray(eVertexFlag_Position);
+		skinData.mpBindNormal = mpSubMesh->GetVertexBuffer()->GetArray(eVertexFlag_Normal);
+		skinData.mpBindTangent = mpSubMesh->GetVertexBuffer()->GetArray(eVertexFlag_Texture1);
+		skinData.mpSkinPos = mpDynVtxBuffer->GetArray(eVertexFlag_Position);
+		skinData.mpSkinNormal = mpDynVtxBuffer->GetArray(eVertexFlag_Normal);
+		skinData.mpSkinTangent = mpDynVtxBuffer->GetArray(eVertexFlag_Texture1);
+		skinData.mlPosStride = lVtxStride;
+		skinData.mlVtxNum = lVtxNum;
+
+		cSkinning::SkinVertices(skinData);
 
 		float *pSkinPosArray = mpDynVtxBuffer->GetArray(eVertexFlag_Position);
 		if (mpMeshEntity->IsShadowCaster()) {
@@ -170,6 +170,7 @@ private:
 	bool mbUpdateBody;
 
 	bool mbGraphicsUpdated;
+	int mlSkinnedBoneMatricesCount;
 
 	iPhysicsBody *mpBody;
 };
@@ -201,6 +201,7 @@ MODULE_OBJS := \
 	engine/scene/PortalContainer.o \
 	engine/scene/Scene.o \
 	engine/scene/SectorVisibility.o \
+	engine/scene/Skinning.o \
 	engine/scene/SoundEntity.o \
 	engine/scene/SoundSource.o \
 	engine/scene/SubMeshEntity.o \
@@ -386,6 +387,15 @@ MODULE_OBJS += \
 	engine/impl/vertex_buffer_tgl.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	engine/scene/SkinningNEON.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	engine/scene/SkinningSSE2.o
+endif
+
 # This module can be built as a plugin
 ifeq ($(ENABLE_HPL1), DYNAMIC_PLUGIN)
 PLUGIN := 1
@@ -1719,69 +1719,75 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		&Screen::drawShapeSkipScaleDownwind
 	};
 
-	static const DsLineFunc dsLineFunc[] = {
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind
+#define DS_LINE_FUNCS(plot) { \
+		&Screen::drawShapeProcessLineNoScaleUpwind<plot>, \
+		&Screen::drawShapeProcessLineNoScaleDownwind<plot>, \
+		&Screen::drawShapeProcessLineScaleUpwind<plot>, \
+		&Screen::drawShapeProcessLineScaleDownwind<plot> \
+	}
+#define DS_NO_LINE_FUNCS { nullptr, nullptr, nullptr, nullptr }
+
+	// Indexed by plot type, then by scaling and direction
+	static const DsLineFunc dsLineFunc[][4] = {
+		DS_LINE_FUNCS(&Screen::drawShapePlotType0),		// used by Kyra 1 + 2
+		DS_LINE_FUNCS(&Screen::drawShapePlotType1),		// used by Kyra 3
+		DS_NO_LINE_FUNCS,
+		DS_LINE_FUNCS(&Screen::drawShapePlotType3_7),	// used by Kyra 3 (shadow)
+		DS_LINE_FUNCS(&Screen::drawShapePlotType4),		// used by Kyra 1, 2 + 3
+		DS_LINE_FUNCS(&Screen::drawShapePlotType5),		// used by Kyra 1
+		DS_LINE_FUNCS(&Screen::drawShapePlotType6),		// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(&Screen::drawShapePlotType3_7),	// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(&Screen::drawShapePlotType8),		// used by Kyra 2
+		DS_LINE_FUNCS(&Screen::drawShapePlotType9),		// used by Kyra 1 + 3
+		DS_NO_LINE_FUNCS,
+		DS_LINE_FUNCS(&Screen::drawShapePlotType11_15),	// used by Kyra 1 (invisibility) + Kyra 3 (shadow)
+		DS_LINE_FUNCS(&Screen::drawShapePlotType12),	// used by Kyra 2
+		DS_LINE_FUNCS(&Screen::drawShapePlotType13),	// used by Kyra 1
+		DS_LINE_FUNCS(&Screen::drawShapePlotType14),	// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(&Screen::drawShapePlotType11_15),	// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(&Screen::drawShapePlotType16),	// used by LoL PC-98/16 Colors (teleporters),
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_LINE_FUNCS(&Screen::drawShapePlotType20),	// used by LoL (heal spell effect)
+		DS_LINE_FUNCS(&Screen::drawShapePlotType21),	// used by LoL (white tower spirits)
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_NO_LINE_FUNCS,
+		DS_LINE_FUNCS(&Screen::drawShapePlotType33),	// used by LoL (blood spots on the floor)
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_LINE_FUNCS(&Screen::drawShapePlotType37),	// used by LoL (monsters)
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_LINE_FUNCS(&Screen::drawShapePlotType48),	// used by LoL (slime spots on the floor)
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_LINE_FUNCS(&Screen::drawShapePlotType52),	// used by LoL (projectiles)
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS, DS_NO_LINE_FUNCS,
+		DS_NO_LINE_FUNCS
 	};
 
-	static const DsPlotFunc dsPlotFunc[] = {
-		&Screen::drawShapePlotType0,		// used by Kyra 1 + 2
-		&Screen::drawShapePlotType1,		// used by Kyra 3
-		nullptr,
-		&Screen::drawShapePlotType3_7,		// used by Kyra 3 (shadow)
-		&Screen::drawShapePlotType4,		// used by Kyra 1, 2 + 3
-		&Screen::drawShapePlotType5,		// used by Kyra 1
-		&Screen::drawShapePlotType6,		// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType3_7,		// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType8,		// used by Kyra 2
-		&Screen::drawShapePlotType9,		// used by Kyra 1 + 3
-		nullptr,
-		&Screen::drawShapePlotType11_15,	// used by Kyra 1 (invisibility) + Kyra 3 (shadow)
-		&Screen::drawShapePlotType12,		// used by Kyra 2
-		&Screen::drawShapePlotType13,		// used by Kyra 1
-		&Screen::drawShapePlotType14,		// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType11_15,	// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType16,		// used by LoL PC-98/16 Colors (teleporters),
-		nullptr, nullptr, nullptr,
-		&Screen::drawShapePlotType20,		// used by LoL (heal spell effect)
-		&Screen::drawShapePlotType21,		// used by LoL (white tower spirits)
-		nullptr, nullptr, nullptr, nullptr,	nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-		nullptr,
-		&Screen::drawShapePlotType33,		// used by LoL (blood spots on the floor)
-		nullptr, nullptr, nullptr,
-		&Screen::drawShapePlotType37,		// used by LoL (monsters)
-		nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-		&Screen::drawShapePlotType48,		// used by LoL (slime spots on the floor)
-		nullptr, nullptr, nullptr,
-		&Screen::drawShapePlotType52,		// used by LoL (projectiles)
-		nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-		nullptr
-	};
+#undef DS_LINE_FUNCS
+#undef DS_NO_LINE_FUNCS
 
 	int scaleCounterV = 0;
 
-	const int drawFunc = flags & 0x0F;
+	// Only the flip and scale bits select the margin/skip functions; bit 3
+	// is not part of that and would index past the end of their tables
+	const int drawFunc = flags & (kDRAWSHP_XFLIP | kDRAWSHP_YFLIP | kDRAWSHP_SCALE);
 	DsMarginSkipFunc dsProcessMargin = dsMarginFunc[drawFunc];
 	DsMarginSkipFunc dsScaleSkip = dsSkipFunc[drawFunc];
-	DsLineFunc dsProcessLine = dsLineFunc[drawFunc];
+	const int lineFunc = ((drawFunc & kDRAWSHP_SCALE) >> 1) | (drawFunc & kDRAWSHP_XFLIP);
 
 	const int ppc = (flags >> 8) & 0x3F;
-	DsPlotFunc dsPlot = dsPlotFunc[ppc];
-	DsPlotFunc dsPlot2 = dsPlotFunc[ppc], dsPlot3 = dsPlotFunc[ppc];
+	int ppc3 = ppc;
 	if (_vm->gameFlags().gameID == GI_KYRA3 && (flags & kDRAWSHP_PRIORITY))
-		dsPlot3 = dsPlotFunc[ppc & ~8];
+		ppc3 = ppc & ~8;
+	DsLineFunc dsProcessLine2 = dsLineFunc[ppc][lineFunc], dsProcessLine3 = dsLineFunc[ppc3][lineFunc];
 
-	if (!dsPlot || !dsPlot2 || !dsPlot3) {
-		if (!dsPlot2)
+	if (!dsProcessLine2 || !dsProcessLine3) {
+		if (!dsProcessLine2)
 			warning("Missing drawShape plotting method type %d", ppc);
-		if (dsPlot3 != dsPlot2 && !dsPlot3)
-			warning("Missing drawShape plotting method type %d", ppc & ~8);
+		if (ppc3 != ppc && !dsProcessLine3)
+			warning("Missing drawShape plotting method type %d", ppc3);
 		return;
 	}
 
@@ -1963,8 +1969,8 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 				if (cnt > 0) {
 					if (flags & kDRAWSHP_PRIORITY)
 						normalPlot = (curY > _maskMinY && curY < _maskMaxY);
-					dsPlot = normalPlot ? dsPlot2 : dsPlot3;
-					(this->*dsProcessLine)(d, src, dsPlot, cnt, scaleState);
+					DsLineFunc dsProcessLine = normalPlot ? dsProcessLine2 : dsProcessLine3;
+					(this->*dsProcessLine)(d, src, cnt, scaleState);
 				}
 				cnt += _dsOffscreenRight;
 				if (cnt)
@@ -2092,7 +2098,8 @@ int Screen::drawShapeSkipScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt)
 	return found ? 0 : _dsOffscreenScaleVal1;
 }
 
-void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, const DsPlotFunc plot, int &cnt, int16) {
+template<Screen::DsPlotFunc plot>
+void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
@@ -2107,7 +2114,8 @@ void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, c
 	} while (cnt > 0);
 }
 
-void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src, const DsPlotFunc plot, int &cnt, int16) {
+template<Screen::DsPlotFunc plot>
+void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
@@ -2122,7 +2130,8 @@ void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src,
 	} while (cnt > 0);
 }
 
-void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, const DsPlotFunc plot, int &cnt, int16 scaleState) {
+template<Screen::DsPlotFunc plot>
+void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
 	do {
@@ -2150,7 +2159,8 @@ void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, con
 	cnt = -1;
 }
 
-void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, const DsPlotFunc plot, int &cnt, int16 scaleState) {
+template<Screen::DsPlotFunc plot>
+void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
 	do {
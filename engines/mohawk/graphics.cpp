@@ -67,7 +67,7 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
-GraphicsManager::GraphicsManager() {
+GraphicsManager::GraphicsManager() : _cacheUseCounter(0) {
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -85,16 +85,42 @@ void GraphicsManager::clearCache() {
 
 	_cache.clear();
 	_subImageCache.clear();
+	_cacheLastUse.clear();
+}
+
+void GraphicsManager::trimCache(uint32 maxSize) {
+	uint32 size = 0;
+	for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+		Graphics::Surface *surface = it->_value->getSurface();
+		if (surface)
+			size += surface->pitch * surface->h;
+	}
+
+	while (size > maxSize && !_cache.empty()) {
+		uint16 oldestId = _cache.begin()->_key;
+		for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+			if (_cacheLastUse[it->_key] < _cacheLastUse[oldestId])
+				oldestId = it->_key;
+		}
+
+		MohawkSurface *oldest = _cache[oldestId];
+		Graphics::Surface *surface = oldest->getSurface();
+		if (surface)
+			size -= surface->pitch * surface->h;
+
+		delete oldest;
+		_cache.erase(oldestId);
+		_cacheLastUse.erase(oldestId);
+	}
 }
 
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
 	if (!_cache.contains(id))
 		_cache[id] = decodeImage(id);
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	// Myst frees the cache on every card change. Riven keeps it around
+	// across cards and limits its size using trimCache().
+	_cacheLastUse[id] = ++_cacheUseCounter;
 
 	return _cache[id];
 }
@@ -227,6 +253,7 @@ void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
 		error("Image %d already in cache", id);
 
 	_cache[id] = surface;
+	_cacheLastUse[id] = ++_cacheUseCounter;
 }
 
 } // End of namespace Mohawk
@@ -73,6 +73,9 @@ public:
 	// Free all surfaces in the cache
 	void clearCache();
 
+	// Free the least recently used surfaces until the cache holds at most maxSize bytes
+	void trimCache(uint32 maxSize);
+
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
 	MohawkSurface *findImage(uint16 id);
@@ -99,6 +102,10 @@ private:
 	// An image cache that stores images until clearCache() is called
 	Common::HashMap<uint16, MohawkSurface *> _cache;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
+
+	// When each image of _cache was last requested, for trimCache()
+	Common::HashMap<uint16, uint32> _cacheLastUse;
+	uint32 _cacheUseCounter;
 };
 
 } // End of namespace Mohawk
@@ -229,6 +229,12 @@ void MohawkEngine_Riven::doFrame() {
 	_system->updateScreen();
 	uint32 loopElapsed = _system->getMillis() - loopStart;
 
+	// Use the spare time of the frame to prepare the next cards
+	if (loopElapsed < 10 && !_scriptMan->hasQueuedScripts()) {
+		_gfx->prefetchNextImage();
+		loopElapsed = _system->getMillis() - loopStart;
+	}
+
 	// Cut down on CPU usage
 	if (loopElapsed < 10)
 		_system->delayMillis(10 - loopElapsed);
@@ -613,9 +619,10 @@ static const RivenSpecialChange rivenSpecialChange[] = {
 void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	debug (1, "Changing to card %d", dest);
 
-	// Clear the graphics cache (images typically aren't used
-	// on different cards).
-	_gfx->clearCache();
+	// Keep the recently used images around rather than clearing the
+	// graphics cache, the next card's picture may have been prefetched
+	// and the player often comes back to the card they just left.
+	_gfx->trimImageCache();
 
 	if (!isGameVariant(GF_DEMO)) {
 		for (byte i = 0; i < ARRAYSIZE(rivenSpecialChange); i++)
@@ -636,6 +643,9 @@ void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	_card = new RivenCard(this, dest);
 	_card->enter(true);
 
+	// Decode the pictures of the cards the player may go to next while idle
+	_gfx->schedulePrefetch(_card->getDestinationCards());
+
 	// Now we need to redraw the cursor if necessary and handle mouse over scripts
 	_stack->queueMouseCursorRefresh();
 
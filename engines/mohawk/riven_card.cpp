@@ -838,6 +838,16 @@ Common::Array<RivenHotspot *> RivenCard::getHotspots() const {
 	return _hotspots;
 }
 
+Common::Array<uint16> RivenCard::getDestinationCards() const {
+	Common::Array<uint16> cards;
+	for (uint16 i = 0; i < _hotspots.size(); i++) {
+		if (_hotspots[i]->isEnabled())
+			_hotspots[i]->collectCardChanges(cards);
+	}
+
+	return cards;
+}
+
 RivenHotspot *RivenCard::getHotspotByName(const Common::String &name, bool optional) const {
 	int16 nameId = _vm->getStack()->getIdFromName(kHotspotNames, name);
 
@@ -1339,6 +1349,12 @@ void RivenHotspot::applyScriptPatches(uint32 cardGlobalId) {
 	}
 }
 
+void RivenHotspot::collectCardChanges(Common::Array<uint16> &cards) const {
+	for (uint16 i = 0; i < _scripts.size(); i++) {
+		_scripts[i].script->collectCardChanges(cards);
+	}
+}
+
 bool RivenHotspot::isEnabled() const {
 	return (_flags & kFlagEnabled) != 0;
 }
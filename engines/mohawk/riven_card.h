@@ -112,6 +112,9 @@ public:
 	/** Get all the hotspots in the card. To be used for debugging features only */
 	Common::Array<RivenHotspot *> getHotspots() const;
 
+	/** Get the ids of the cards the enabled hotspots of this card may lead to */
+	Common::Array<uint16> getDestinationCards() const;
+
 	/** Activate a hotspot using a hotspot enable list entry */
 	void activateHotspotEnableRecord(uint16 index);
 
@@ -273,6 +276,9 @@ public:
 	/** Apply patches to the hotspot's scripts to fix bugs in the original game scripts */
 	void applyScriptPatches(uint32 cardGlobalId);
 
+	/** Add the ids of the cards the hotspot's scripts may switch to */
+	void collectCardChanges(Common::Array<uint16> &cards) const;
+
 	/** Apply patches to the hotspot's properties to fix bugs in the original game scripts */
 	void applyPropertiesPatches(uint32 cardGlobalId);
 
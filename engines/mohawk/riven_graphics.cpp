@@ -27,6 +27,7 @@
 #include "mohawk/riven_stack.h"
 #include "mohawk/riven_video.h"
 
+#include "common/algorithm.h"
 #include "common/system.h"
 #include "common/memstream.h"
 
@@ -354,6 +355,46 @@ RivenGraphics::~RivenGraphics() {
 	delete _menuFont;
 }
 
+void RivenGraphics::trimImageCache() {
+	// Enough for a few dozen full screen images
+	trimCache(16 * 1024 * 1024);
+}
+
+void RivenGraphics::schedulePrefetch(const Common::Array<uint16> &cards) {
+	_prefetchCards.clear();
+
+	for (uint i = 0; i < cards.size() && _prefetchCards.size() < 8; i++) {
+		if (Common::find(_prefetchCards.begin(), _prefetchCards.end(), cards[i]) == _prefetchCards.end())
+			_prefetchCards.push_back(cards[i]);
+	}
+}
+
+void RivenGraphics::prefetchNextImage() {
+	if (_prefetchCards.empty())
+		return;
+
+	uint16 cardId = _prefetchCards.remove_at(0);
+	if (!_vm->hasResource(ID_PLST, cardId))
+		return;
+
+	// Cards draw their first picture when entered, unless their scripts say otherwise
+	Common::SeekableReadStream *plst = _vm->getResource(ID_PLST, cardId);
+	uint16 recordCount = plst->readUint16BE();
+	for (uint16 i = 0; i < recordCount; i++) {
+		uint16 index = plst->readUint16BE();
+		uint16 id = plst->readUint16BE();
+		plst->skip(8); // rect
+
+		if (index == 1) {
+			if (_vm->hasResource(ID_TBMP, id))
+				preloadImage(id);
+			break;
+		}
+	}
+
+	delete plst;
+}
+
 MohawkSurface *RivenGraphics::decodeImage(uint16 id) {
 	Common::SeekableReadStream *resourceStream = _vm->getResource(ID_TBMP, id);
 	Common::SeekableReadStream *memResourceStream = resourceStream->readStream(resourceStream->size());
@@ -370,11 +411,13 @@ void RivenGraphics::copyImageToScreen(uint16 image, uint32 left, uint32 top, uin
 	beginScreenUpdate();
 
 	// Clip the width to fit on the screen. Fixes some images.
-	if (left + surface->w > 608)
-		surface->w = 608 - left;
+	// The cached surface is left alone, it may be drawn elsewhere on another card.
+	int width = surface->w;
+	if (left + width > 608)
+		width = 608 - left;
 
 	for (uint16 i = 0; i < surface->h; i++)
-		memcpy(_mainScreen->getBasePtr(left, i + top), surface->getBasePtr(0, i), surface->w * surface->format.bytesPerPixel);
+		memcpy(_mainScreen->getBasePtr(left, i + top), surface->getBasePtr(0, i), width * surface->format.bytesPerPixel);
 
 	_dirtyScreen = true;
 	applyScreenUpdate();
@@ -671,6 +714,7 @@ void RivenGraphics::drawExtrasImage(uint16 id, const Common::Rect &dstRect) {
 void RivenGraphics::beginCredits() {
 	// Clear the old cache
 	clearCache();
+	_prefetchCards.clear();
 
 	_creditsImage = kRivenCreditsZeroImage;
 	_creditsPos = 0;
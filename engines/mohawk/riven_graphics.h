@@ -107,6 +107,14 @@ public:
 	void updateCredits();
 	uint getCurCreditsImage() const { return _creditsImage; }
 
+	// Image cache
+	/** Free the least recently used images, keeping the cache within its budget */
+	void trimImageCache();
+	/** Replace the list of cards whose first picture should be decoded ahead of time */
+	void schedulePrefetch(const Common::Array<uint16> &cards);
+	/** Decode the picture of one of the scheduled cards, to be called while idle */
+	void prefetchNextImage();
+
 protected:
 	MohawkSurface *decodeImage(uint16 id) override;
 	MohawkEngine *getVM() override { return (MohawkEngine *)_vm; }
@@ -145,6 +153,9 @@ private:
 
 	// Credits
 	uint _creditsImage, _creditsPos;
+
+	// Image cache
+	Common::Array<uint16> _prefetchCards;
 };
 
 /**
@@ -130,6 +130,9 @@ public:
 	/** Apply patches to card script to fix bugs in the original game scripts */
 	void applyCardPatches(MohawkEngine_Riven *vm, uint32 cardGlobalId, uint16 scriptType, uint16 hotspotId);
 
+	/** Add the ids of the cards in the current stack this script may switch to */
+	void collectCardChanges(Common::Array<uint16> &cards) const;
+
 	/** Append the commands of the other script to this script */
 	RivenScript &operator+=(const RivenScript &other);
 
@@ -266,6 +269,9 @@ public:
 	/** Apply card patches for the command's sub-scripts */
 	virtual void applyCardPatches(uint32 globalId, int scriptType, uint16 hotspotId) {}
 
+	/** Add the ids of the cards in the current stack the command may switch to */
+	virtual void collectCardChanges(Common::Array<uint16> &cards) const {}
+
 protected:
 	MohawkEngine_Riven *_vm;
 };
@@ -290,6 +296,7 @@ public:
 	void dump(byte tabs) override;
 	void execute() override;
 	RivenCommandType getType() const override;
+	void collectCardChanges(Common::Array<uint16> &cards) const override;
 
 private:
 	typedef void (RivenSimpleCommand::*OpcodeProcRiven)(uint16 op, const ArgumentArray &args);
@@ -364,6 +371,7 @@ public:
 	void execute() override;
 	RivenCommandType getType() const override;
 	void applyCardPatches(uint32 globalId, int scriptType, uint16 hotspotId) override;
+	void collectCardChanges(Common::Array<uint16> &cards) const override;
 
 private:
 	RivenSwitchCommand(MohawkEngine_Riven *vm);
@@ -75,7 +75,8 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		_shakeEffect(nullptr), _rotationEffect(nullptr),
 		_backgroundSoundScriptLastRoomId(0),
 		_backgroundSoundScriptLastAgeId(0),
-		_transition(nullptr), _frameLimiter(nullptr), _inventoryManualHide(false) {
+		_transition(nullptr), _frameLimiter(nullptr), _prefetchNextFace(0),
+		_inventoryManualHide(false) {
 
 	// Add subdirectories to the search path to allow running from a full HDD install
 	const Common::FSNode gameDataDir(ConfMan.getPath("path"));
@@ -106,6 +107,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 }
 
 Myst3Engine::~Myst3Engine() {
+	clearPrefetchedFaces();
 	closeArchives();
 
 	delete _menu;
@@ -220,6 +222,8 @@ Common::Error Myst3Engine::run() {
 		}
 
 		drawFrame();
+
+		prefetchNextCubeFace();
 	}
 
 	unloadNode();
@@ -900,6 +904,7 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 
 	Common::String newRoomName = _db->getRoomName(roomID, ageID);
 	if ((!_archiveNode || _archiveNode->getRoomName() != newRoomName) && !_db->isCommonRoom(roomID, ageID)) {
+		clearPrefetchedFaces();
 
 		Common::String nodeFile = Common::String::format("%snodes.m3a", newRoomName.c_str());
 
@@ -924,6 +929,106 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 	// Releeshan to the player when he is trapped between both shields.
 	if (nodeID == 9 && roomID == kRoomNarayan)
 		_state->setVar(39, 0);
+
+	schedulePrefetch();
+}
+
+void Myst3Engine::schedulePrefetch() {
+	_prefetchNodes.clear();
+	_prefetchNextFace = 0;
+
+	if (_state->getViewType() != kCube)
+		return;
+
+	uint16 currentNode = _state->getLocationNode();
+	NodePtr nodeData = _db->getNodeData(currentNode, _state->getLocationRoom(), _state->getLocationAge());
+	if (!nodeData)
+		return;
+
+	// Collect the nodes of the current room the hotspots of this node lead to.
+	// Destinations stored in variables are ignored, they depend on the game state.
+	for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+		const Common::Array<Opcode> &script = nodeData->hotspots[i].script;
+
+		for (uint j = 0; j < script.size(); j++) {
+			const Opcode &cmd = script[j];
+
+			switch (cmd.op) {
+			case 136: // goToNodeTransition
+			case 137: // goToNodeTrans2
+			case 138: // goToNodeTrans1
+			case 140: // zipToNode
+			case 164: // changeNode
+				break;
+			default:
+				continue;
+			}
+
+			if (cmd.args.empty() || cmd.args[0] <= 0 || cmd.args[0] == currentNode)
+				continue;
+
+			uint16 node = cmd.args[0];
+			if (Common::find(_prefetchNodes.begin(), _prefetchNodes.end(), node) == _prefetchNodes.end()
+			        && _prefetchNodes.size() < kMaxPrefetchedCubeFaces / 6) {
+				_prefetchNodes.push_back(node);
+			}
+		}
+	}
+}
+
+void Myst3Engine::prefetchNextCubeFace() {
+	if (_prefetchNodes.empty())
+		return;
+
+	uint16 node = _prefetchNodes.front();
+	uint16 face = _prefetchNextFace;
+
+	if (++_prefetchNextFace == 6) {
+		_prefetchNodes.remove_at(0);
+		_prefetchNextFace = 0;
+	}
+
+	Common::String room = _db->getRoomName(_state->getLocationRoom(), _state->getLocationAge());
+
+	for (uint i = 0; i < _prefetchedFaces.size(); i++) {
+		if (_prefetchedFaces[i].node == node && _prefetchedFaces[i].face == face && _prefetchedFaces[i].room == room) {
+			// Already decoded, mark it as recently used
+			PrefetchedCubeFace prefetched = _prefetchedFaces[i];
+			_prefetchedFaces.remove_at(i);
+			_prefetchedFaces.push_back(prefetched);
+			return;
+		}
+	}
+
+	ResourceDescription jpegDesc = getFileDescription("", node, face + 1, Archive::kCubeFace);
+	if (!jpegDesc.isValid())
+		return;
+
+	if (_prefetchedFaces.size() >= kMaxPrefetchedCubeFaces) {
+		_prefetchedFaces.front().bitmap->free();
+		delete _prefetchedFaces.front().bitmap;
+		_prefetchedFaces.remove_at(0);
+	}
+
+	PrefetchedCubeFace prefetched;
+	prefetched.room = room;
+	prefetched.node = node;
+	prefetched.face = face;
+	prefetched.bitmap = decodeJpeg(&jpegDesc);
+	_prefetchedFaces.push_back(prefetched);
+
+	debugC(kDebugNode, "Prefetched face %d of node %d", face, node);
+}
+
+void Myst3Engine::clearPrefetchedFaces() {
+	for (uint i = 0; i < _prefetchedFaces.size(); i++) {
+		_prefetchedFaces[i].bitmap->free();
+		delete _prefetchedFaces[i].bitmap;
+	}
+
+	_prefetchedFaces.clear();
+	_prefetchNodes.clear();
+	_prefetchNextFace = 0;
 }
 
 void Myst3Engine::unloadNode() {
@@ -1455,6 +1560,21 @@ Graphics::Surface *Myst3Engine::decodeJpeg(const ResourceDescription *jpegDesc)
 	return rgbaSurface;
 }
 
+Graphics::Surface *Myst3Engine::decodeCubeFace(uint16 nodeID, uint16 face, const ResourceDescription *jpegDesc) {
+	Common::String room = _db->getRoomName(_state->getLocationRoom(), _state->getLocationAge());
+
+	for (uint i = 0; i < _prefetchedFaces.size(); i++) {
+		if (_prefetchedFaces[i].node == nodeID && _prefetchedFaces[i].face == face && _prefetchedFaces[i].room == room) {
+			// The caller takes ownership of the prefetched surface
+			Graphics::Surface *bitmap = _prefetchedFaces[i].bitmap;
+			_prefetchedFaces.remove_at(i);
+			return bitmap;
+		}
+	}
+
+	return decodeJpeg(jpegDesc);
+}
+
 int16 Myst3Engine::openDialog(uint16 id) {
 	Dialog *dialog;
 
@@ -133,6 +133,7 @@ public:
 
 	Graphics::Surface *loadTexture(uint16 id);
 	static Graphics::Surface *decodeJpeg(const ResourceDescription *jpegDesc);
+	Graphics::Surface *decodeCubeFace(uint16 nodeID, uint16 face, const ResourceDescription *jpegDesc);
 
 	void goToNode(uint16 nodeID, TransitionType transition);
 	void loadNode(uint16 nodeID, uint32 roomID = 0, uint32 ageID = 0);
@@ -215,6 +216,28 @@ private:
 	Graphics::FrameLimiter *_frameLimiter;
 	Transition *_transition;
 
+	/**
+	 * Cube faces of the nodes reachable from the current node are decoded
+	 * ahead of time, one face per frame, so that moving to a neighbouring
+	 * node does not have to wait for the JPEG decoder.
+	 */
+	struct PrefetchedCubeFace {
+		Common::String room;
+		uint16 node;
+		uint16 face;
+		Graphics::Surface *bitmap;
+	};
+
+	static const uint kMaxPrefetchedCubeFaces = 18;
+
+	Common::Array<PrefetchedCubeFace> _prefetchedFaces; // Least recently used first
+	Common::Array<uint16> _prefetchNodes;
+	uint _prefetchNextFace;
+
+	void schedulePrefetch();
+	void prefetchNextCubeFace();
+	void clearPrefetchedFaces();
+
 	bool _inputSpacePressed;
 	bool _inputEnterPressed;
 	bool _inputEscapePressed;
@@ -47,6 +47,8 @@ public:
 	~Face();
 
 	void setTextureFromJPEG(const ResourceDescription *jpegDesc);
+	/** Use an already decoded bitmap, the face takes ownership of it */
+	void setTextureFromBitmap(Graphics::Surface *bitmap);
 
 	void addTextureDirtyRect(const Common::Rect &rect);
 	bool isTextureDirty() { return _textureDirty; }
@@ -118,6 +118,16 @@ MODULE_OBJS += \
 	debugger/debugtools.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	system/graphics/gr_draw_sprite_rle_neon.o
+endif
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	system/graphics/gr_draw_sprite_rle_sse2.o
+endif
+
 # This module can be built as a plugin
 ifeq ($(ENABLE_QDENGINE), DYNAMIC_PLUGIN)
 PLUGIN := 1
@@ -591,6 +591,24 @@ private:
 	static char *_wnd_class_name;
 
 	void putSpr_rot90(const Vect2i &pos, const Vect2i &size, const byte *data, bool has_alpha, int mode, float angle);
+
+	// Scaled RLE sprites are resampled once into a frame cached by the
+	// RLEBuffer. Frame pixels hold the screen color with the alpha in the
+	// lowest byte, alpha 255 marks a transparent pixel.
+	void putScaledFrame_rle(int x, int y, int sx, int sy, const uint32 *frame);
+
+	typedef void (*blendSpriteRowFunc)(uint32 *dst, const uint32 *src, int count);
+	static blendSpriteRowFunc _blendSpriteRow32;
+
+	static void blendSpriteRow32(uint32 *dst, const uint32 *src, int count);
+	static void blendSpriteRow32Generic(uint32 *dst, const uint32 *src, int count);
+#ifdef SCUMMVM_SSE2
+	static void blendSpriteRow32SSE2(uint32 *dst, const uint32 *src, int count);
+#endif
+#ifdef SCUMMVM_NEON
+	static void blendSpriteRow32NEON(uint32 *dst, const uint32 *src, int count);
+#endif
+	static void blendSpriteRow565(uint16 *dst, const uint32 *src, int count);
 };
 
 } // namespace QDEngine
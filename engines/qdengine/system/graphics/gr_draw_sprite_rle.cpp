@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "graphics/managed_surface.h"
 
@@ -181,6 +182,24 @@ void grDispatcher::putSpr_rle(int x, int y, int sx, int sy, const class RLEBuffe
 
 	if (sx_dest <= 0 || sy_dest <= 0) return;
 
+	uint32 key = (mode & (GR_FLIP_HORIZONTAL | GR_FLIP_VERTICAL)) | (alpha_flag ? 1 : 0) | (_pixel_format << 8);
+
+	const uint32 *frame = p->scaled_frame(sx_dest, sy_dest, key);
+	if (frame) {
+		putScaledFrame_rle(x, y, sx_dest, sy_dest, frame);
+		return;
+	}
+
+	Std::vector<uint32> tmp_frame;
+	uint32 *frame_buf = p->alloc_scaled_frame(sx_dest, sy_dest, key);
+	if (!frame_buf) {
+		tmp_frame.resize(sx_dest * sy_dest);
+		frame_buf = &tmp_frame[0];
+	}
+
+	// The last row and column are not drawn
+	Common::fill(frame_buf, frame_buf + sx_dest * sy_dest, 0xFFu);
+
 	int dx = (sx << 16) / sx_dest;
 	int dy = (sy << 16) / sy_dest;
 	int fx = (1 << 15);
@@ -205,62 +224,99 @@ void grDispatcher::putSpr_rle(int x, int y, int sx, int sy, const class RLEBuffe
 		x1 = 0;
 		ix = -1;
 	}
-	if (!alpha_flag) {
-		const byte *line_src = RLEBuffer::get_buffer(0);
-		for (int i = y0; i != y1; i += iy) {
-			p->decode_line(fy >> 16);
 
-			fy += dy;
-			fx = (1 << 15);
+	const byte *line_src = RLEBuffer::get_buffer(0);
+	int decoded_line = -1;
 
-			for (int j = x0; j != x1; j += ix) {
-				if (clipCheck(x + j, y + i)) {
-					const byte *src_data = line_src + (fx >> 16) * 3;
-					if (src_data[0] || src_data[1] || src_data[2])
-						setPixelFast(x + j, y + i, make_rgb(src_data[2], src_data[1], src_data[0]));
+	for (int i = y0; i != y1; i += iy) {
+		if (decoded_line != fy >> 16) {
+			decoded_line = fy >> 16;
+			p->decode_line(decoded_line);
+		}
+
+		fy += dy;
+		fx = (1 << 15);
+
+		uint32 *frame_line = frame_buf + i * sx_dest;
+		for (int j = x0; j != x1; j += ix) {
+			const byte *src_data = line_src + ((fx >> 16) << 2);
+
+			if (!alpha_flag) {
+				if (src_data[0] || src_data[1] || src_data[2]) {
+					if (_pixel_format == GR_RGB565)
+						frame_line[j] = make_rgb565u(src_data[2], src_data[1], src_data[0]) << 16;
+					else
+						frame_line[j] = make_rgb(src_data[2], src_data[1], src_data[0]) << 8;
 				}
-				fx += dx;
+			} else {
+				uint32 a = src_data[3];
+				if (_pixel_format == GR_RGB565)
+					frame_line[j] = (make_rgb565u(src_data[2], src_data[1], src_data[0]) << 16) | a;
+				else
+					frame_line[j] = (src_data[2] << 24) | (src_data[1] << 16) | (src_data[0] << 8) | a;
 			}
+			fx += dx;
 		}
-	} else {
-		const byte *line_src = RLEBuffer::get_buffer(0);
-		for (int i = y0; i != y1; i += iy) {
-			p->decode_line(fy >> 16);
+	}
 
-			fy += dy;
-			fx = (1 << 15);
+	putScaledFrame_rle(x, y, sx_dest, sy_dest, frame_buf);
+}
 
-			for (int j = x0; j != x1; j += ix) {
-				if (clipCheck(x + j, y + i)) {
-					const byte *src_data = line_src + ((fx >> 16) << 2);
+void grDispatcher::putScaledFrame_rle(int x, int y, int sx, int sy, const uint32 *frame) {
+	int x0 = MAX(x, _clipCoords[GR_LEFT]);
+	int x1 = MIN(x + sx, _clipCoords[GR_RIGHT]);
+	int y0 = MAX(y, _clipCoords[GR_TOP]);
+	int y1 = MIN(y + sy, _clipCoords[GR_BOTTOM]);
 
-					uint32 a = src_data[3];
-					if (a != 255) {
-						if (_pixel_format == GR_RGB565) {
-							uint32 cl = make_rgb565u(src_data[2], src_data[1], src_data[0]);
+	if (x0 >= x1 || y0 >= y1) return;
 
-							if (a) {
-								uint16 scl;
-								getPixel(x + j, y + i, scl);
+	for (int i = y0; i < y1; i++) {
+		const uint32 *src = frame + (i - y) * sx + (x0 - x);
 
-								setPixelFast(x + j, y + i, alpha_blend_565(cl, scl, a));
-							} else
-								setPixelFast(x + j, y + i, cl);
-						} else {
-							byte sr, sg, sb;
-							getPixel(x + j, y + i, sr, sg, sb);
+		if (_pixel_format == GR_RGB565)
+			blendSpriteRow565((uint16 *)_screenBuf->getBasePtr(x0, i), src, x1 - x0);
+		else
+			blendSpriteRow32((uint32 *)_screenBuf->getBasePtr(x0, i), src, x1 - x0);
+	}
+}
+
+grDispatcher::blendSpriteRowFunc grDispatcher::_blendSpriteRow32 = nullptr;
+
+void grDispatcher::blendSpriteRow32(uint32 *dst, const uint32 *src, int count) {
+	if (!_blendSpriteRow32) {
+		_blendSpriteRow32 = blendSpriteRow32Generic;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			_blendSpriteRow32 = blendSpriteRow32NEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			_blendSpriteRow32 = blendSpriteRow32SSE2;
+#endif
+	}
 
-							uint32 r = src_data[2] + ((a * sr) >> 8);
-							uint32 g = src_data[1] + ((a * sg) >> 8);
-							uint32 b = src_data[0] + ((a * sb) >> 8);
+	_blendSpriteRow32(dst, src, count);
+}
 
-							setPixelFast(x + j, y + i, r, g, b);
-						}
-					}
-				}
-				fx += dx;
-			}
-		}
+void grDispatcher::blendSpriteRow32Generic(uint32 *dst, const uint32 *src, int count) {
+	for (int i = 0; i < count; i++) {
+		uint32 a = src[i] & 0xFF;
+		if (a == 255)
+			continue;
+
+		uint32 r = (a * (dst[i] >> 24)) >> 8;
+		uint32 g = (a * ((dst[i] >> 16) & 0xFF)) >> 8;
+		uint32 b = (a * ((dst[i] >> 8) & 0xFF)) >> 8;
+
+		dst[i] = (src[i] & 0xFFFFFF00) + ((r << 24) | (g << 16) | (b << 8));
+	}
+}
+
+void grDispatcher::blendSpriteRow565(uint16 *dst, const uint32 *src, int count) {
+	for (int i = 0; i < count; i++) {
+		uint32 a = src[i] & 0xFF;
+		if (a != 255)
+			dst[i] = alpha_blend_565(src[i] >> 16, dst[i], a);
 	}
 }
 
@@ -0,0 +1,81 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "qdengine/system/graphics/gr_dispatcher.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace QDEngine {
+
+void grDispatcher::blendSpriteRow32NEON(uint32 *dst, const uint32 *src, int count) {
+	const uint32x4_t alphaMask = vdupq_n_u32(0xFF);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		uint32x4_t s = vld1q_u32(src + i);
+		uint32x4_t d = vld1q_u32(dst + i);
+
+		// Spread the alpha over the four bytes of each pixel
+		uint32x4_t a = vandq_u32(s, alphaMask);
+		uint8x16_t a8 = vreinterpretq_u8_u32(vmulq_n_u32(a, 0x01010101));
+		uint8x16_t d8 = vreinterpretq_u8_u32(d);
+
+		uint16x8_t mLo = vmull_u8(vget_low_u8(d8), vget_low_u8(a8));
+		uint16x8_t mHi = vmull_u8(vget_high_u8(d8), vget_high_u8(a8));
+		uint32x4_t m = vreinterpretq_u32_u8(vcombine_u8(vshrn_n_u16(mLo, 8), vshrn_n_u16(mHi, 8)));
+
+		uint32x4_t out = vaddq_u32(vbicq_u32(s, alphaMask), vbicq_u32(m, alphaMask));
+
+		// Alpha 255 keeps the screen pixel
+		vst1q_u32(dst + i, vbslq_u32(vceqq_u32(a, alphaMask), d, out));
+	}
+
+	if (i < count)
+		blendSpriteRow32Generic(dst + i, src + i, count - i);
+}
+
+} // namespace QDEngine
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
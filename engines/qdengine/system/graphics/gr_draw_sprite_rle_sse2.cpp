@@ -0,0 +1,81 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "qdengine/system/graphics/gr_dispatcher.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace QDEngine {
+
+void grDispatcher::blendSpriteRow32SSE2(uint32 *dst, const uint32 *src, int count) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32(0xFF);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+
+		// Spread the alpha over the four 16-bit channels of each pixel
+		__m128i a = _mm_and_si128(s, alphaMask);
+		__m128i a16 = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+		__m128i aLo = _mm_unpacklo_epi32(a16, a16);
+		__m128i aHi = _mm_unpackhi_epi32(a16, a16);
+
+		// a * channel fits into 16 bits
+		__m128i mLo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), aLo), 8);
+		__m128i mHi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), aHi), 8);
+		__m128i m = _mm_packus_epi16(mLo, mHi);
+
+		__m128i out = _mm_add_epi32(_mm_andnot_si128(alphaMask, s), _mm_andnot_si128(alphaMask, m));
+
+		// Alpha 255 keeps the screen pixel
+		__m128i transparent = _mm_cmpeq_epi32(a, alphaMask);
+		out = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, out));
+
+		_mm_storeu_si128((__m128i *)(dst + i), out);
+	}
+
+	if (i < count)
+		blendSpriteRow32Generic(dst + i, src + i, count - i);
+}
+
+} // namespace QDEngine
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
@@ -33,6 +33,13 @@ byte *g_buffer0 = nullptr;
 byte *g_buffer1 = nullptr;
 uint32 g_buffersLen = 0;
 
+// Buffers holding a scaled copy of their picture, see RLEBuffer::scaled_frame()
+static Std::vector<const RLEBuffer *> g_scaledFrames;
+static uint32 g_scaledFramesSize = 0;
+static uint32 g_scaledFramesStamp = 0;
+
+static const uint32 kScaledFramesMaxSize = 16 * 1024 * 1024;
+
 static void ensureBuffers() {
 	if (g_buffer0 == nullptr) {
 		g_buffer0 = (byte *)calloc(4096, 1);
@@ -51,19 +58,25 @@ bool operator == (const RLEBuffer &buf1, const RLEBuffer &buf2) {
 	return true;
 }
 
-RLEBuffer::RLEBuffer() : _bits_per_pixel(32) {
+RLEBuffer::RLEBuffer() : _bits_per_pixel(32), _scaled_sx(0), _scaled_sy(0), _scaled_key(0), _scaled_stamp(0) {
 }
 
 RLEBuffer::RLEBuffer(const RLEBuffer &buf) : _header_offset(buf._header_offset),
 	_data_offset(buf._data_offset),
 	_header(buf._header),
 	_data(buf._data),
-	_bits_per_pixel(buf._bits_per_pixel) {
+	_bits_per_pixel(buf._bits_per_pixel),
+	_scaled_sx(0),
+	_scaled_sy(0),
+	_scaled_key(0),
+	_scaled_stamp(0) {
 
 	ensureBuffers();
 }
 
 RLEBuffer::~RLEBuffer() {
+	drop_scaled_frame();
+
 	_header_offset.clear();
 	_data_offset.clear();
 	_header.clear();
@@ -94,11 +107,63 @@ void RLEBuffer::releaseBuffers() {
 	g_buffer0 = nullptr;
 	free(g_buffer1);
 	g_buffer1 = nullptr;
+
+	while (!g_scaledFrames.empty())
+		g_scaledFrames.back()->drop_scaled_frame();
+}
+
+const uint32 *RLEBuffer::scaled_frame(int sx, int sy, uint32 key) const {
+	if (_scaled.empty() || _scaled_sx != sx || _scaled_sy != sy || _scaled_key != key)
+		return nullptr;
+
+	_scaled_stamp = ++g_scaledFramesStamp;
+	return &_scaled[0];
+}
+
+uint32 *RLEBuffer::alloc_scaled_frame(int sx, int sy, uint32 key) const {
+	drop_scaled_frame();
+
+	uint32 size = sx * sy * sizeof(uint32);
+	if (size > kScaledFramesMaxSize / 4)
+		return nullptr;
+
+	// Drop the least recently used copies until the new one fits
+	while (g_scaledFramesSize + size > kScaledFramesMaxSize) {
+		const RLEBuffer *oldest = g_scaledFrames.front();
+		for (uint i = 1; i < g_scaledFrames.size(); i++) {
+			if (g_scaledFrames[i]->_scaled_stamp < oldest->_scaled_stamp)
+				oldest = g_scaledFrames[i];
+		}
+		oldest->drop_scaled_frame();
+	}
+
+	_scaled.resize(sx * sy);
+	_scaled_sx = sx;
+	_scaled_sy = sy;
+	_scaled_key = key;
+	_scaled_stamp = ++g_scaledFramesStamp;
+
+	g_scaledFrames.push_back(this);
+	g_scaledFramesSize += size;
+
+	return &_scaled[0];
+}
+
+void RLEBuffer::drop_scaled_frame() const {
+	if (_scaled.empty())
+		return;
+
+	g_scaledFramesSize -= _scaled.size() * sizeof(uint32);
+	g_scaledFrames.erase(Common::find(g_scaledFrames.begin(), g_scaledFrames.end(), this));
+
+	Std::vector<uint32>().swap(_scaled);
 }
 
 RLEBuffer &RLEBuffer::operator = (const RLEBuffer &buf) {
 	if (this == &buf) return *this;
 
+	drop_scaled_frame();
+
 	_header_offset = buf._header_offset;
 	_data_offset = buf._data_offset;
 
@@ -111,6 +176,8 @@ RLEBuffer &RLEBuffer::operator = (const RLEBuffer &buf) {
 }
 
 bool RLEBuffer::encode(int sx, int sy, const byte *buf) {
+	drop_scaled_frame();
+
 	_header_offset.resize(sy);
 	_data_offset.resize(sy);
 
@@ -222,6 +289,8 @@ bool RLEBuffer::convert_data(int bits_per_pixel) {
 	if (_bits_per_pixel == bits_per_pixel)
 		return true;
 
+	drop_scaled_frame();
+
 	int sz = _data.size();
 
 	switch (_bits_per_pixel) {
@@ -325,6 +394,8 @@ int RLEBuffer::line_header_length(int line_num) const {
 
 
 bool RLEBuffer::load(Common::SeekableReadStream *fh) {
+	drop_scaled_frame();
+
 	uint32 sz = fh->readUint32LE();
 	_header_offset.resize(sz);
 
@@ -70,6 +70,13 @@ public:
 
 	static void releaseBuffers();
 
+	// Scaled copy of the picture, cached between draws. Each buffer keeps
+	// one copy, the key describes how it was made (flip, alpha, pixel format).
+	// The copies of all buffers share a fixed memory budget.
+	const uint32 *scaled_frame(int sx, int sy, uint32 key) const;
+	uint32 *alloc_scaled_frame(int sx, int sy, uint32 key) const;
+	void drop_scaled_frame() const;
+
 private:
 	Std::vector<uint32> _header_offset;
 	Std::vector<uint32> _data_offset;
@@ -79,6 +86,12 @@ private:
 
 	int _bits_per_pixel;
 
+	mutable Std::vector<uint32> _scaled;
+	mutable int _scaled_sx;
+	mutable int _scaled_sy;
+	mutable uint32 _scaled_key;
+	mutable uint32 _scaled_stamp;
+
 	friend bool operator == (const RLEBuffer &buf1, const RLEBuffer &buf2);
 };
 
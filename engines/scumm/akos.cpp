@@ -277,10 +277,17 @@ void AkosRenderer::setPalette(uint16 *new_palette) {
 	}
 }
 
+AkosRenderer::~AkosRenderer() {
+	for (DecodedCelMap::iterator i = _decodedCels.begin(); i != _decodedCels.end(); ++i)
+		free(i->_value.pixels);
+}
+
 void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costumeID = costume;
+
 	_akhd = (const AkosHeader *)_vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	_akof = (const AkosOffset *)_vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	_akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -1044,6 +1051,60 @@ byte AkosRenderer::paintCelCDATRLE(int xmoveCur, int ymoveCur) {
 	return 0;
 }
 
+void AkosRenderer::purgeDecodedCels(uint32 neededSize) {
+	while (!_decodedCels.empty() && _decodedCelsSize + neededSize > kDecodedCelsBudget) {
+		DecodedCelMap::iterator oldest = _decodedCels.begin();
+		for (DecodedCelMap::iterator i = _decodedCels.begin(); i != _decodedCels.end(); ++i) {
+			if (i->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = i;
+		}
+
+		_decodedCelsSize -= oldest->_value.width * oldest->_value.height;
+		free(oldest->_value.pixels);
+		_decodedCels.erase(oldest);
+	}
+}
+
+const byte *AkosRenderer::getDecodedMajMinCel(const byte *src, int width, int height) {
+	uint64 key = ((uint64)_costumeID << 32) | (uint32)(src - _akcd);
+	uint32 size = width * height;
+
+	DecodedCelMap::iterator i = _decodedCels.find(key);
+	if (i != _decodedCels.end() && i->_value.width == width && i->_value.height == height) {
+		i->_value.lastUsed = ++_decodedCelsTick;
+		return i->_value.pixels;
+	}
+
+	if (i != _decodedCels.end()) {
+		_decodedCelsSize -= i->_value.width * i->_value.height;
+		free(i->_value.pixels);
+		_decodedCels.erase(i);
+	}
+
+	// Cels which would not fit at all are decoded straight to the screen
+	if (size > kDecodedCelsBudget)
+		return nullptr;
+
+	purgeDecodedCels(size);
+
+	DecodedCel cel;
+	cel.pixels = (byte *)malloc(size);
+	if (!cel.pixels)
+		return nullptr;
+	cel.width = width;
+	cel.height = height;
+	cel.lastUsed = ++_decodedCelsTick;
+
+	MajMinCodec majMin;
+	majMin.setupBitReader(*src, src + 1);
+	majMin.decodeLine(cel.pixels, size, 1);
+
+	_decodedCels[key] = cel;
+	_decodedCelsSize += size;
+
+	return cel.pixels;
+}
+
 void AkosRenderer::majMinCodecDecompress(byte *dest, int32 pitch, const byte *src, int32 width, int32 height, int32 dir,
 		int32 numSkipBefore, int32 numSkipAfter, byte transparency, int maskLeft, int maskTop, int zBuf) {
 
@@ -1052,16 +1113,21 @@ void AkosRenderer::majMinCodecDecompress(byte *dest, int32 pitch, const byte *sr
 	int maskPitch;
 	byte *maskPtr;
 	const byte maskBit = revBitMask(maskLeft & 7);
+	const byte *celPtr = getDecodedMajMinCel(src, _width, _height);
 
 	if (dir < 0) {
 		dest -= (width - 1);
 		tmpBuf += (width - 1);
 	}
 
-	majMin.setupBitReader(*src, src + 1);
+	if (celPtr) {
+		celPtr += numSkipBefore;
+	} else {
+		majMin.setupBitReader(*src, src + 1);
 
-	if (numSkipBefore != 0) {
-		majMin.skipData(numSkipBefore);
+		if (numSkipBefore != 0) {
+			majMin.skipData(numSkipBefore);
+		}
 	}
 
 	maskPitch = _numStrips;
@@ -1071,12 +1137,22 @@ void AkosRenderer::majMinCodecDecompress(byte *dest, int32 pitch, const byte *sr
 	assert(height > 0);
 	assert(width > 0);
 	while (height--) {
-		majMin.decodeLine(tmpBuf, width, dir);
+		if (celPtr) {
+			if (dir > 0) {
+				memcpy(tmpBuf, celPtr, width);
+			} else {
+				for (int i = 0; i < width; i++)
+					tmpBuf[-i] = celPtr[i];
+			}
+			celPtr += width + numSkipAfter;
+		} else {
+			majMin.decodeLine(tmpBuf, width, dir);
+		}
 		bompApplyMask(majMin._majMinData.buffer, maskPtr, maskBit, width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadowMode, _shadowTable, majMin._majMinData.buffer, dest, width, transparency, HE7Check);
 
-		if (numSkipAfter != 0)	{
+		if (!celPtr && numSkipAfter != 0)	{
 			majMin.skipData(numSkipAfter);
 		}
 		dest += pitch;
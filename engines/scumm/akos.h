@@ -22,6 +22,8 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/hashmap.h"
+
 #include "scumm/base-costume.h"
 #include "scumm/he/wiz_he.h"
 
@@ -95,6 +97,33 @@ protected:
 	const byte *_rgbs;  // Raw costume RGB colors (HE specific)
 	const uint8 *_xmap; // shadow color table (HE specific)
 
+	int _costumeID;
+
+	// Cache of fully decoded MajMin cels, keyed by costume and cel offset.
+	// The cached pixels are raw color indices, so they stay valid across
+	// palette, shadow, mirror and z-plane changes, which are all applied
+	// when the cel is blitted.
+	struct DecodedCel {
+		byte *pixels;
+		int width, height;
+		uint32 lastUsed;
+	};
+
+	// Common::Hash<uint64> only looks at the low 32 bits, which would drop
+	// the costume ID, so fold both halves together and mix them.
+	struct DecodedCelHash {
+		uint operator()(uint64 key) const {
+			return (uint)(((key ^ (key >> 32)) * 0x9E3779B97F4A7C15ULL) >> 32);
+		}
+	};
+
+	typedef Common::HashMap<uint64, DecodedCel, DecodedCelHash> DecodedCelMap;
+	DecodedCelMap _decodedCels;
+	uint32 _decodedCelsSize;
+	uint32 _decodedCelsTick;
+
+	static const uint32 kDecodedCelsBudget = 2 * 1024 * 1024;
+
 
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
@@ -109,8 +138,13 @@ public:
 		_rgbs = nullptr;
 		_xmap = nullptr;
 		_actorHitMode = false;
+		_costumeID = 0;
+		_decodedCelsSize = 0;
+		_decodedCelsTick = 0;
 	}
 
+	~AkosRenderer() override;
+
 	bool _actorHitMode = false;
 	int16 _actorHitX = 0, _actorHitY = 0;
 	bool _actorHitResult = false;
@@ -136,6 +170,9 @@ protected:
 		int32 specialRenderFlags);
 #endif
 
+	const byte *getDecodedMajMinCel(const byte *src, int width, int height);
+	void purgeDecodedCels(uint32 neededSize);
+
 	void majMinCodecDecompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numSkipBefore, int32 numSkipAfter, byte transparency, int maskLeft, int maskTop, int zBuf);
 
 	void markRectAsDirty(Common::Rect rect);
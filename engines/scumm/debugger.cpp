@@ -111,6 +111,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 #endif
 
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
+	registerCmd("frametime",       WRAP_METHOD(ScummDebugger, Cmd_FrameTime));
 }
 
 void ScummDebugger::preEnter() {
@@ -1414,4 +1415,29 @@ bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_FrameTime(int argc, const char **argv) {
+	// The update times are measured in milliseconds, so their average is only
+	// meaningful over many frames
+	const uint32 minFrames = 100;
+
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		_vm->_screenUpdateFrames = 0;
+		_vm->_screenUpdateTotalTime = 0;
+		debugPrintf("Screen update timings reset\n");
+		return true;
+	}
+
+	if (_vm->_screenUpdateFrames < minFrames) {
+		debugPrintf("Only %d frames drawn, need at least %d for an average\n", _vm->_screenUpdateFrames, minFrames);
+		return true;
+	}
+
+	debugPrintf("Screen updates: %d frames, %d ms total, %.3f ms average\n",
+		_vm->_screenUpdateFrames, _vm->_screenUpdateTotalTime,
+		(float)_vm->_screenUpdateTotalTime / _vm->_screenUpdateFrames);
+	debugPrintf("Use 'frametime reset' to start a new measurement\n");
+
+	return true;
+}
+
 } // End of namespace Scumm
@@ -527,6 +527,8 @@ void ScummEngine::markRectAsDirty(VirtScreenNumber virt, int left, int right, in
  * code in the backend is controlled from here.
  */
 void ScummEngine::drawDirtyScreenParts() {
+	uint32 startTime = _system->getMillis();
+
 	// Update verbs
 	updateDirtyScreen(kVerbVirtScreen);
 
@@ -542,6 +544,11 @@ void ScummEngine::drawDirtyScreenParts() {
 	} else {
 		updateDirtyScreen(kMainVirtScreen);
 	}
+
+	// Most frames take less than a millisecond, but as the updates start at
+	// random points within a millisecond, the sum over many frames is right.
+	_screenUpdateFrames++;
+	_screenUpdateTotalTime += _system->getMillis() - startTime;
 }
 
 void ScummEngine_v6::drawDirtyScreenParts() {
@@ -703,28 +710,48 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 			const byte *srcPtr = (const byte *)src;
 			const byte *textPtr = (byte *)_textSurface.getBasePtr(x * m, y * m);
 			byte *dstPtr = _compositeBuf;
+			const int srcBpp = vs->format.bytesPerPixel;
+			const int textPitch = _textSurface.pitch - width * m;
 
 			for (int h = 0; h < height * m; ++h) {
-				for (int w = 0; w < width * m; ++w) {
-					uint16 tmp = *textPtr++;
-					if (tmp == CHARSET_MASK_TRANSPARENCY) {
-						tmp = READ_UINT16(srcPtr);
-						WRITE_UINT16(dstPtr, tmp); dstPtr += 2;
-					} else if (_game.heversion != 0) {
-						error ("16Bit Color HE Game using old charset");
-					} else {
-						WRITE_UINT16(dstPtr, _16BitPalette[tmp]); dstPtr += 2;
+				int w = 0;
+				while (w < width * m) {
+					// Copy runs of transparent text pixels straight from the
+					// game graphics, and only look up the palette for text.
+					int run = 0;
+					while (w + run < width * m && textPtr[run] == CHARSET_MASK_TRANSPARENCY)
+						++run;
+
+					if (run) {
+						if (srcBpp == 2) {
+							memcpy(dstPtr, srcPtr, run * 2);
+						} else {
+							for (int i = 0; i < run; ++i)
+								WRITE_UINT16(dstPtr + i * 2, READ_UINT16(srcPtr + i * srcBpp));
+						}
+						dstPtr += run * 2;
+						srcPtr += run * srcBpp;
+						textPtr += run;
+						w += run;
+						continue;
 					}
-					srcPtr += vs->format.bytesPerPixel;
+
+					if (_game.heversion != 0)
+						error ("16Bit Color HE Game using old charset");
+
+					WRITE_UINT16(dstPtr, _16BitPalette[*textPtr++]); dstPtr += 2;
+					srcPtr += srcBpp;
+					++w;
 				}
 				srcPtr += vsPitch;
-				textPtr += _textSurface.pitch - width * m;
+				textPtr += textPitch;
 			}
 		} else {
 #ifdef USE_ARM_GFX_ASM
 			asmDrawStripToScreen(height, width, text, src, _compositeBuf, vs->pitch, width, _textSurface.pitch);
 #else
-			// We blit four pixels at a time, for improved performance.
+			// We blit four (or, where unaligned 64-bit access is cheap, eight)
+			// pixels at a time, for improved performance.
 			const uint32 *src32 = (const uint32 *)src;
 			uint32 *dst32 = (uint32 *)_compositeBuf;
 
@@ -733,7 +760,23 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 			const uint32 *text32 = (const uint32 *)text;
 			const int textPitch = (_textSurface.pitch - width * m) >> 2;
 			for (int h = height * m; h > 0; --h) {
-				for (int w = width * m; w > 0; w -= 4) {
+				int w = width * m;
+#ifndef SCUMM_NEED_ALIGNMENT
+				for (; w >= 8; w -= 8) {
+					uint64 temp = READ_UINT64(text32);
+					text32 += 2;
+
+					// Same as the four pixel variant below, on twice the width.
+					uint64 mask = temp ^ ((uint64)CHARSET_MASK_TRANSPARENCY_32 << 32 | CHARSET_MASK_TRANSPARENCY_32);
+					mask = (((mask & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | mask) & 0x8080808080808080ULL;
+					mask = ((mask >> 7) + 0x7f7f7f7f7f7f7f7fULL) ^ 0x8080808080808080ULL;
+
+					WRITE_UINT64(dst32, ((temp ^ READ_UINT64(src32)) & mask) ^ temp);
+					dst32 += 2;
+					src32 += 2;
+				}
+#endif
+				for (; w > 0; w -= 4) {
 					uint32 temp = *text32++;
 
 					// Generate a byte mask for those text pixels (bytes) with
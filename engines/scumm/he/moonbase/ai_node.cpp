@@ -19,6 +19,8 @@
  *
  */
 
+#include "common/memorypool.h"
+
 #include "scumm/he/moonbase/ai_node.h"
 
 namespace Scumm {
@@ -30,6 +32,21 @@ IContainedObject::IContainedObject(IContainedObject &sourceContainedObject) {
 
 int Node::_nodeCount = 0;
 
+static Common::ObjectPool<Node, 0> &getNodePool() {
+	static Common::ObjectPool<Node, 0> nodePool;
+	return nodePool;
+}
+
+void *Node::operator new(size_t size) {
+	assert(size == sizeof(Node));
+	return getNodePool().allocChunk();
+}
+
+void Node::operator delete(void *ptr) {
+	if (ptr)
+		getNodePool().freeChunk(ptr);
+}
+
 Node::Node() {
 	_parent = nullptr;
 	_depth = 0;
@@ -76,6 +76,11 @@ public:
 	Node(Node *sourceNode);
 	~Node();
 
+	// Search trees allocate and free large numbers of nodes per turn,
+	// so they are carved out of a shared pool instead of the heap.
+	static void *operator new(size_t size);
+	static void operator delete(void *ptr);
+
 	void setParent(Node *parentPtr) { _parent = parentPtr; }
 	Node *getParent() const { return _parent; }
 
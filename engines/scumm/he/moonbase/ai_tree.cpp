@@ -27,13 +27,62 @@
 
 namespace Scumm {
 
-static int compareTreeNodes(const void *a, const void *b) {
-	if (((const TreeNode *)a)->value < ((const TreeNode *)b)->value)
-		return -1;
-	else if (((const TreeNode *)a)->value > ((const TreeNode *)b)->value)
-		return 1;
-	else
-		return 0;
+void TreeNodeHeap::siftUp(uint idx) {
+	TreeNode item = _heap[idx];
+
+	while (idx > 0) {
+		uint parent = (idx - 1) / 2;
+
+		if (!(item < _heap[parent]))
+			break;
+
+		_heap[idx] = _heap[parent];
+		idx = parent;
+	}
+
+	_heap[idx] = item;
+}
+
+void TreeNodeHeap::siftDown(uint idx) {
+	TreeNode item = _heap[idx];
+	uint size = _heap.size();
+
+	while (true) {
+		uint child = idx * 2 + 1;
+
+		if (child >= size)
+			break;
+
+		if (child + 1 < size && _heap[child + 1] < _heap[child])
+			child++;
+
+		if (!(_heap[child] < item))
+			break;
+
+		_heap[idx] = _heap[child];
+		idx = child;
+	}
+
+	_heap[idx] = item;
+}
+
+void TreeNodeHeap::push(float value, Node *node) {
+	_heap.push_back(TreeNode(value, _nextOrder++, node));
+	siftUp(_heap.size() - 1);
+}
+
+Node *TreeNodeHeap::pop() {
+	assert(!_heap.empty());
+
+	Node *node = _heap[0].node;
+
+	_heap[0] = _heap.back();
+	_heap.pop_back();
+
+	if (!_heap.empty())
+		siftDown(0);
+
+	return node;
 }
 
 Tree::Tree(AI *ai) : _ai(ai) {
@@ -42,8 +91,6 @@ Tree::Tree(AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
@@ -53,8 +100,6 @@ Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
@@ -64,8 +109,6 @@ Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
 	_maxNodes = MAX_NODES;
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai(ai) {
@@ -75,8 +118,6 @@ Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai
 	_maxNodes = maxNodes;
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
-
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 }
 
 void Tree::duplicateTree(Node *sourceNode, Node *destNode) {
@@ -95,7 +136,6 @@ Tree::Tree(const Tree *sourceTree, AI *ai) : _ai(ai) {
 	pBaseNode = new Node(sourceTree->getBaseNode());
 	_maxDepth = sourceTree->getMaxDepth();
 	_maxNodes = sourceTree->getMaxNodes();
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
 
@@ -119,12 +159,10 @@ Tree::~Tree() {
 			pTemp = nullptr;
 		}
 	}
-
-	delete _currentMap;
 }
 
 Node *Tree::aStarSearch() {
-	Common::SortedArray<TreeNode *> mmfpOpen(compareTreeNodes);
+	TreeNodeHeap mmfpOpen;
 
 	Node *currentNode = nullptr;
 	float currentT;
@@ -134,11 +172,10 @@ Node *Tree::aStarSearch() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		mmfpOpen.insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		mmfpOpen.push(pBaseNode->getObjectT(), pBaseNode);
 
 		while (mmfpOpen.size() && (retNode == nullptr)) {
-			currentNode = mmfpOpen.front()->node;
-			mmfpOpen.erase(mmfpOpen.begin());
+			currentNode = mmfpOpen.pop();
 
 			if ((currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes)) {
 				// Generate nodes
@@ -151,7 +188,7 @@ Node *Tree::aStarSearch() {
 					if (currentT == SUCCESS)
 						retNode = *i;
 					else
-						mmfpOpen.insert(new TreeNode(currentT, (*i)));
+						mmfpOpen.push(currentT, (*i));
 				}
 			} else {
 				retNode = currentNode;
@@ -173,7 +210,7 @@ Node *Tree::aStarSearch_singlePassInit() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		_currentMap->insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		_currentMap.push(pBaseNode->getObjectT(), pBaseNode);
 	} else {
 		retNode = pBaseNode;
 	}
@@ -192,13 +229,12 @@ Node *Tree::aStarSearch_singlePass() {
 	}
 
 	if (_currentChildIndex) {
-		if (!(_currentMap->size())) {
+		if (!(_currentMap.size())) {
 			retNode = _currentNode;
 			return retNode;
 		}
 
-		_currentNode = _currentMap->front()->node;
-		_currentMap->erase(_currentMap->begin());
+		_currentNode = _currentMap.pop();
 	}
 
 	if ((_currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes) && ((!maxTime) || (_ai->getTimerValue(3) < maxTime))) {
@@ -208,7 +244,7 @@ Node *Tree::aStarSearch_singlePass() {
 		if (_currentChildIndex) {
 			Common::Array<Node *> vChildren = _currentNode->getChildren();
 
-			if (!vChildren.size() && !_currentMap->size()) {
+			if (!vChildren.size() && !_currentMap.size()) {
 				_currentChildIndex = 0;
 				retNode = _currentNode;
 			}
@@ -221,11 +257,11 @@ Node *Tree::aStarSearch_singlePass() {
 					retNode = *i;
 					i = vChildren.end() - 1;
 				} else {
-					_currentMap->insert(new TreeNode(currentT, (*i)));
+					_currentMap.push(currentT, (*i));
 				}
 			}
 
-			if (!(_currentMap->size()) && (currentT != SUCCESS)) {
+			if (!(_currentMap.size()) && (currentT != SUCCESS)) {
 				assert(_currentNode != nullptr);
 				retNode = _currentNode;
 			}
@@ -34,9 +34,41 @@ class AI;
 
 struct TreeNode {
 	float value;
+	uint32 order;
 	Node *node;
 
-	TreeNode(float v, Node *n) { value = v; node = n; }
+	TreeNode() { value = 0; order = 0; node = nullptr; }
+	TreeNode(float v, uint32 o, Node *n) { value = v; order = o; node = n; }
+
+	// Ties are broken by insertion order, so that the expansion order
+	// (and thus the AI's decisions) stays deterministic.
+	bool operator<(const TreeNode &other) const {
+		if (value != other.value)
+			return value < other.value;
+		return order < other.order;
+	}
+};
+
+/**
+ * Binary min-heap of open nodes, ordered by T-value.
+ */
+class TreeNodeHeap {
+private:
+	Common::Array<TreeNode> _heap;
+	uint32 _nextOrder;
+
+	void siftUp(uint idx);
+	void siftDown(uint idx);
+
+public:
+	TreeNodeHeap() : _nextOrder(0) {}
+
+	void push(float value, Node *node);
+	Node *pop();
+
+	uint size() const { return _heap.size(); }
+	bool empty() const { return _heap.empty(); }
+	void clear() { _heap.clear(); _nextOrder = 0; }
 };
 
 class Tree {
@@ -48,7 +80,7 @@ private:
 
 	int _currentChildIndex;
 
-	Common::SortedArray<TreeNode *> *_currentMap;
+	TreeNodeHeap _currentMap;
 	Node *_currentNode;
 
 	AI *_ai;
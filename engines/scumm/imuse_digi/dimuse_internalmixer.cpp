@@ -298,35 +298,35 @@ int IMuseDigiInternalMixer::loop(uint8 **destBuffer, int len) {
 	if (_outChannelCount == 2)
 		len *= 2;
 
+	// Convert the mix buffer through the soft limiter table, writing only
+	// the output word size which is actually in use
 	if (!_stereoReverseFlag || _outChannelCount == 1) {
-		if (_outWordSize != 16) {
-			if (len) {
-				for (int i = 0; i < len; i++) {
-					destBuffer_tmp[i] = ((uint8 *)_softLMID)[mixBuffer[i]];
-				}
+		if (_outWordSize == 16) {
+			const uint16 *softL16 = (const uint16 *)_softLMID;
+			uint16 *dest16 = (uint16 *)destBuffer_tmp;
+			for (int i = 0; i < len; i++) {
+				dest16[i] = softL16[mixBuffer[i]];
 			}
-		}
-
-		if (len) {
+		} else {
+			const uint8 *softL8 = (const uint8 *)_softLMID;
 			for (int i = 0; i < len; i++) {
-				((uint16 *)destBuffer_tmp)[i] = ((uint16 *)_softLMID)[mixBuffer[i]];
+				destBuffer_tmp[i] = softL8[mixBuffer[i]];
 			}
 		}
 	} else {
 		len /= 2;
 		if (_outWordSize == 16) {
-			if (len) {
-				for (int i = 0; i < len; i += 2) {
-					((uint16 *)destBuffer_tmp)[i]     = ((uint16 *)_softLMID)[mixBuffer[i + 1]];
-					((uint16 *)destBuffer_tmp)[i + 1] = ((uint16 *)_softLMID)[mixBuffer[i]];
-				}
+			const uint16 *softL16 = (const uint16 *)_softLMID;
+			uint16 *dest16 = (uint16 *)destBuffer_tmp;
+			for (int i = 0; i < len; i += 2) {
+				dest16[i]     = softL16[mixBuffer[i + 1]];
+				dest16[i + 1] = softL16[mixBuffer[i]];
 			}
-		}
-
-		if (len) {
+		} else {
+			const uint8 *softL8 = (const uint8 *)_softLMID;
 			for (int i = 0; i < len; i += 2) {
-				destBuffer_tmp[i] = ((uint8 *)_softLMID)[mixBuffer[i + 1]];
-				destBuffer_tmp[i + 1] = ((uint8 *)_softLMID)[mixBuffer[i]];
+				destBuffer_tmp[i]     = softL8[mixBuffer[i + 1]];
+				destBuffer_tmp[i + 1] = softL8[mixBuffer[i]];
 			}
 		}
 	}
@@ -540,9 +540,11 @@ void IMuseDigiInternalMixer::mixBits16Mono(uint8 *srcBuf, int32 inFrameCount, in
 	mixBufCurCell = (uint16 *)(&_mixBuf[2 * mixBufStartIndex]);
 	if (feedSize == inFrameCount) {
 		if (feedSize) {
-			srcBuf_ptr = (uint16 *)srcBuf;
+			// Same lookup as below: ((s & 0xFFF7) >> 3) bytes is (s >> 4) words
+			const int16 *ampTable16 = (const int16 *)ampTable + 2048;
+			const int16 *src16 = (const int16 *)srcBuf;
 			for (int i = 0; i < feedSize; i++) {
-				mixBufCurCell[i] += *(uint16 *)((uint8 *)ampTable + (((int16)srcBuf_ptr[i] & (int16)0xFFF7) >> 3) + 4096);
+				mixBufCurCell[i] += ampTable16[src16[i] >> 4];
 			}
 		}
 	} else if (2 * inFrameCount == feedSize) {
@@ -1041,10 +1043,14 @@ void IMuseDigiInternalMixer::mixBits16ConvertToStereo(uint8 *srcBuf, int32 inFra
 
 	if (feedSize == inFrameCount) {
 		if (feedSize) {
-			srcBuf_tmp = (uint16 *)srcBuf;
+			// Same lookup as below: ((s & 0xFFF7) >> 3) bytes is (s >> 4) words
+			const int16 *leftAmpTable16 = (const int16 *)leftAmpTable + 2048;
+			const int16 *rightAmpTable16 = (const int16 *)rightAmpTable + 2048;
+			const int16 *src16 = (const int16 *)srcBuf;
 			for (int i = 0; i < feedSize; i++) {
-				mixBufCurCell[0] += *(uint16 *)((uint8 *)leftAmpTable  + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
-				mixBufCurCell[1] += *(uint16 *)((uint8 *)rightAmpTable + (((int16)srcBuf_tmp[i] & (int16)0xFFF7) >> 3) + 4096);
+				int idx = src16[i] >> 4;
+				mixBufCurCell[0] += leftAmpTable16[idx];
+				mixBufCurCell[1] += rightAmpTable16[idx];
 				mixBufCurCell += 2;
 			}
 		}
@@ -1306,13 +1312,11 @@ void IMuseDigiInternalMixer::mixBits16Stereo(uint8 *srcBuf, int32 inFrameCount,
 	mixBufCurCell = (uint16 *)(&_mixBuf[4 * mixBufStartIndex]);
 	if (feedSize == inFrameCount) {
 		if (feedSize) {
-			srcBuf_ptr = (uint16 *)srcBuf;
-
-			for (int i = 0; i < feedSize; i++) {
-				mixBufCurCell[0] += *(uint16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[0] & (int16)0xFFF7) >> 3) + 4096);
-				mixBufCurCell[1] += *(uint16 *)((int8 *)ampTable + (((int16)srcBuf_ptr[1] & (int16)0xFFF7) >> 3) + 4096);
-				srcBuf_ptr += 2;
-				mixBufCurCell += 2;
+			// Same lookup as below: ((s & 0xFFF7) >> 3) bytes is (s >> 4) words
+			const int16 *ampTable16 = (const int16 *)ampTable + 2048;
+			const int16 *src16 = (const int16 *)srcBuf;
+			for (int i = 0; i < 2 * feedSize; i++) {
+				mixBufCurCell[i] += ampTable16[src16[i] >> 4];
 			}
 		}
 	} else if (2 * inFrameCount == feedSize) {
@@ -1424,6 +1424,11 @@ protected:
 	bool _supportsEGADithering = false;
 	bool _enableSegaShadowMode = false;
 
+	// Time spent composing and blitting dirty screen areas, shown by the
+	// "frametime" debugger command.
+	uint32 _screenUpdateFrames = 0;
+	uint32 _screenUpdateTotalTime = 0;
+
 	virtual void drawDirtyScreenParts();
 	void updateDirtyScreen(VirtScreenNumber slot);
 	void drawStripToScreen(VirtScreen *vs, int x, int width, int top, int bottom);
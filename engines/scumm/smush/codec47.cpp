@@ -55,13 +55,18 @@ namespace Scumm {
 
 #endif
 
-#define FILL_4X1_LINE(dst, val) \
-	do {                        \
-		(dst)[0] = val;         \
-		(dst)[1] = val;         \
-		(dst)[2] = val;         \
-		(dst)[3] = val;         \
-	} while (0)
+// Rows of 8 pixels are moved as a single 64-bit word. READ/WRITE_UINT64
+// take care of unaligned access on platforms which need it.
+#define COPY_8X1_LINE(dst, src) \
+	WRITE_UINT64(dst, READ_UINT64(src))
+
+// The FILL_*_WORD variants take a color which has already been replicated
+// into every byte of the word.
+#define FILL_8X1_WORD(dst, val64) \
+	WRITE_UINT64(dst, val64)
+
+#define FILL_4X1_WORD(dst, val32) \
+	WRITE_UINT32(dst, val32)
 
 #define FILL_2X1_LINE(dst, val) \
 	do {                        \
@@ -274,6 +279,21 @@ void SmushDeltaGlyphsDecoder::makeTablesInterpolation(int sideLength) {
 				}
 			}
 
+			// Also keep the glyph as per-row byte masks, which lets the C
+			// decoder fill a whole glyph row at once, independently of the
+			// frame width.
+			int glyph = x * 16 + y;
+			byte rowMask[8];
+			for (int row = 0; row < sideLength; row++) {
+				for (int col = 0; col < sideLength; col++)
+					rowMask[col] = tableSmallBig[row * sideLength + col] ? 0xFF : 0x00;
+
+				if (sideLength == 8)
+					_glyphRowsBig[glyph * 8 + row] = READ_UINT64(rowMask);
+				else
+					_glyphRowsSmall[glyph * 4 + row] = READ_UINT32(rowMask);
+			}
+
 			if (sideLength == 8) {
 				for (i = 64 - 1; i >= 0; i--) {
 					if (tableSmallBig[i] != 0) {
@@ -419,26 +439,18 @@ void SmushDeltaGlyphsDecoder::level2(byte *d_dst) {
 		d_dst += 2;
 		level3(d_dst);
 	} else if (code == FILL_SINGLE_COLOR) {
-		byte t = *_dSrc++;
+		uint32 t = *_dSrc++ * 0x01010101U;
 		for (i = 0; i < 4; i++) {
-			FILL_4X1_LINE(d_dst, t);
+			FILL_4X1_WORD(d_dst, t);
 			d_dst += _dPitch;
 		}
 	} else if (code == DRAW_GLYPH) {
-		byte *tmpPtr = _tableSmall + *_dSrc++ * 128;
-		int32 l = tmpPtr[96];
-		byte val = *_dSrc++;
-		int16 *tmpPtr2 = (int16 *)tmpPtr;
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
-		}
-		l = tmpPtr[97];
-		val = *_dSrc++;
-		tmpPtr2 = (int16 *)(tmpPtr + 32);
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
+		const uint32 *glyphRows = _glyphRowsSmall + *_dSrc++ * 4;
+		uint32 fg = *_dSrc++ * 0x01010101U;
+		uint32 bg = *_dSrc++ * 0x01010101U;
+		for (i = 0; i < 4; i++) {
+			FILL_4X1_WORD(d_dst, (glyphRows[i] & fg) | (~glyphRows[i] & bg));
+			d_dst += _dPitch;
 		}
 	} else if (code == COPY_PREV_BUFFER) {
 		tmp = _offset2;
@@ -447,9 +459,9 @@ void SmushDeltaGlyphsDecoder::level2(byte *d_dst) {
 			d_dst += _dPitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		uint32 t = _paramPtr[code] * 0x01010101U;
 		for (i = 0; i < 4; i++) {
-			FILL_4X1_LINE(d_dst, t);
+			FILL_4X1_WORD(d_dst, t);
 			d_dst += _dPitch;
 		}
 	}
@@ -463,8 +475,7 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 	if (code < MOTION_OFFSET_TABLE_SIZE) {
 		tmp = _table[code] + _offset1;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _dPitch;
 		}
 	} else if (code == PROCESS_SUBBLOCKS) {
@@ -476,41 +487,29 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 		d_dst += 4;
 		level2(d_dst);
 	} else if (code == FILL_SINGLE_COLOR) {
-		byte t = *_dSrc++;
+		uint64 t = *_dSrc++ * 0x0101010101010101ULL;
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_WORD(d_dst, t);
 			d_dst += _dPitch;
 		}
 	} else if (code == DRAW_GLYPH) {
-		tmp = *_dSrc++;
-		byte *tmpPtr = _tableBig + tmp * 388;
-		byte l = tmpPtr[384];
-		byte val = *_dSrc++;
-		int16 *tmpPtr2 = (int16 *)tmpPtr;
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
-		}
-		l = tmpPtr[385];
-		val = *_dSrc++;
-		tmpPtr2 = (int16 *)(tmpPtr + 128);
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmpPtr2)) = val;
-			tmpPtr2++;
+		const uint64 *glyphRows = _glyphRowsBig + *_dSrc++ * 8;
+		uint64 fg = *_dSrc++ * 0x0101010101010101ULL;
+		uint64 bg = *_dSrc++ * 0x0101010101010101ULL;
+		for (i = 0; i < 8; i++) {
+			FILL_8X1_WORD(d_dst, (glyphRows[i] & fg) | (~glyphRows[i] & bg));
+			d_dst += _dPitch;
 		}
 	} else if (code == COPY_PREV_BUFFER) {
 		tmp = _offset2;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _dPitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		uint64 t = _paramPtr[code] * 0x0101010101010101ULL;
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_WORD(d_dst, t);
 			d_dst += _dPitch;
 		}
 	}
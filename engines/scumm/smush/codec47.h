@@ -41,6 +41,8 @@ private:
 	byte *_tableBig;
 	byte *_tableSmall;
 	int16 _table[256];
+	uint64 _glyphRowsBig[256 * 8];
+	uint32 _glyphRowsSmall[256 * 4];
 	int32 _frameSize;
 	int _width, _height;
 
@@ -151,7 +151,9 @@ Common::Array<int> Graph::getPath(int source, int target) {
 
 void PathFinder::setWalkboxes(const Common::Array<Walkbox> &walkboxes) {
 	_walkboxes = walkboxes;
-	_graph = nullptr;
+	_current = 0;
+	_graphs.clear();
+	_graphs.resize(_walkboxes.size());
 }
 
 Math::Vector2d Walkbox::getClosestPointOnEdge(const Math::Vector2d &p) const {
@@ -195,7 +197,7 @@ bool PathFinder::inLineOfSight(const Math::Vector2d &start, const Math::Vector2d
 	const float epsilon = 0.5f;
 
 	// Not in LOS if any of the ends is outside the polygon
-	if (!_walkboxes[0].contains(start) || !_walkboxes[0].contains(to))
+	if (!_walkboxes[_current].contains(start) || !_walkboxes[_current].contains(to))
 		return false;
 
 	// In LOS if it's the same start and end location
@@ -205,6 +207,8 @@ bool PathFinder::inLineOfSight(const Math::Vector2d &start, const Math::Vector2d
 	// Not in LOS if any edge is intersected by the start-end line segment
 	for (uint i = 0; i < _walkboxes.size(); i++) {
 		const Walkbox &walkbox = _walkboxes[i];
+		if (!walkbox.overlaps(start, to))
+			continue;
 		const Common::Array<Vector2i> &polygon = walkbox.getPoints();
 		const uint size = polygon.size();
 		for (uint j = 0; j < size; j++) {
@@ -221,10 +225,10 @@ bool PathFinder::inLineOfSight(const Math::Vector2d &start, const Math::Vector2d
 
 	// Finally the middle point in the segment determines if in LOS or not
 	const Math::Vector2d v2 = (start + to) / 2.0f;
-	if (!_walkboxes[0].contains(v2))
+	if (!_walkboxes[_current].contains(v2))
 		return false;
-	for (uint i = 1; i < _walkboxes.size(); i++) {
-		if (_walkboxes[i].contains(v2, false))
+	for (uint i = 0; i < _walkboxes.size(); i++) {
+		if ((i != _current) && _walkboxes[i].contains(v2, false))
 			return false;
 	}
 	return true;
@@ -235,7 +239,7 @@ Common::SharedPtr<Graph> PathFinder::createGraph() {
 	for (uint i = 0; i < _walkboxes.size(); i++) {
 		const Walkbox &walkbox = _walkboxes[i];
 		if (walkbox.getPoints().size() > 2) {
-			bool firstWalkbox = (i == 0);
+			bool firstWalkbox = (i == _current);
 			if (!walkbox.isVisible())
 				firstWalkbox = true;
 			for (uint j = 0; j < walkbox.getPoints().size(); j++) {
@@ -266,40 +270,36 @@ Common::Array<Math::Vector2d> PathFinder::calculatePath(const Math::Vector2d &s,
 	Math::Vector2d to(t);
 	Common::Array<Math::Vector2d> result;
 	if (!_walkboxes.empty()) {
-		// find the walkbox where the actor is and put it first
+		// find the walkbox where the actor is
 		for (uint i = 0; i < _walkboxes.size(); i++) {
 			const Walkbox &wb = _walkboxes[i];
-			if (wb.contains(start) && (i != 0)) {
-				_graph.reset();
-				SWAP(_walkboxes[0], _walkboxes[i]);
+			if (wb.contains(start) && (i != _current)) {
+				_current = i;
 				break;
 			}
 		}
 
 		// if no walkbox has been found => find the nearest walkbox
-		if (!_walkboxes[0].contains(start)) {
+		if (!_walkboxes[_current].contains(start)) {
 			Common::Array<float> dists(_walkboxes.size());
 			for (uint i = 0; i < _walkboxes.size(); i++) {
 				const Walkbox &wb = _walkboxes[i];
 				dists[i] = distance(wb.getClosestPointOnEdge(start), start);
 			}
 
-			const size_t index = minIndex(dists);
-			if (index != 0) {
-				_graph.reset();
-				SWAP(_walkboxes[0], _walkboxes[index]);
-			}
+			_current = minIndex(dists);
 		}
 
-		if (!_graph)
-			_graph = createGraph();
+		// the graph only depends on the walkboxes and the starting one, so keep it until they change
+		if (!_graphs[_current])
+			_graphs[_current] = createGraph();
 
 		// create new node on start position
-		_walkgraph = *_graph;
+		_walkgraph = *_graphs[_current];
 		const uint startNodeIndex = _walkgraph._nodes.size();
 
 		// if destination is not inside current walkable area, then get the closest point
-		const Walkbox &wb = _walkboxes[0];
+		const Walkbox &wb = _walkboxes[_current];
 		if (wb.isVisible() && !wb.contains(start)) {
 			start = wb.getClosestPointOnEdge(start);
 		}
@@ -308,8 +308,8 @@ Common::Array<Math::Vector2d> PathFinder::calculatePath(const Math::Vector2d &s,
 		}
 		// we don't want the actor to walk in a different walkbox
 		// then check if endpoint is inside one of the other walkboxes and find the closest point on edge
-		for (uint i = 1; i < _walkboxes.size(); i++) {
-			if (_walkboxes[i].contains(to)) {
+		for (uint i = 0; i < _walkboxes.size(); i++) {
+			if ((i != _current) && _walkboxes[i].contains(to)) {
 				to = _walkboxes[i].getClosestPointOnEdge(to);
 				break;
 			}
@@ -98,12 +98,15 @@ public:
 	bool isVisible() const { return _visible; }
 	const Common::Array<Vector2i> &getPoints() const { return _polygon; }
 	Math::Vector2d getClosestPointOnEdge(const Math::Vector2d &p) const;
+	// Indicates whether or not the bounding box of the segment overlaps the bounding box of this walkbox.
+	bool overlaps(const Math::Vector2d &start, const Math::Vector2d &to) const;
 
 public:
 	Common::String _name;
 
 private:
 	Common::Array<Vector2i> _polygon;
+	Vector2i _min, _max; // Bounding box of the polygon
 	bool _visible;
 };
 
@@ -123,7 +126,8 @@ private:
 
 private:
 	Common::Array<Walkbox> _walkboxes;
-	Common::SharedPtr<Graph> _graph;
+	uint _current = 0;                               // Index of the walkbox where the path starts
+	Common::Array<Common::SharedPtr<Graph> > _graphs; // Graph for each starting walkbox, built on demand
 	Graph _walkgraph;
 	bool _isDirty = true;
 };
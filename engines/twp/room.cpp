@@ -494,6 +494,20 @@ Layer::Layer(const Common::StringArray &name, const Math::Vector2d &parallax, in
 
 Walkbox::Walkbox(const Common::Array<Vector2i> &polygon, bool visible)
 	: _polygon(polygon), _visible(visible) {
+	if (!_polygon.empty()) {
+		_min = _max = _polygon[0];
+		for (size_t i = 1; i < _polygon.size(); i++) {
+			_min.x = MIN(_min.x, _polygon[i].x);
+			_min.y = MIN(_min.y, _polygon[i].y);
+			_max.x = MAX(_max.x, _polygon[i].x);
+			_max.y = MAX(_max.y, _polygon[i].y);
+		}
+	}
+}
+
+bool Walkbox::overlaps(const Math::Vector2d &start, const Math::Vector2d &to) const {
+	return (MAX(start.getX(), to.getX()) >= _min.x) && (MIN(start.getX(), to.getX()) <= _max.x) &&
+		   (MAX(start.getY(), to.getY()) >= _min.y) && (MIN(start.getY(), to.getY()) <= _max.y);
 }
 
 bool Walkbox::concave(int vertex) const {
@@ -517,6 +531,10 @@ bool Walkbox::contains(const Math::Vector2d &position, bool toleranceOnOutside)
 	if (_polygon.size() < 3)
 		return false;
 
+	// Points further than 1 from the bounding box can't be inside or on an edge
+	if ((point.getX() < _min.x - 1) || (point.getX() > _max.x + 1) || (point.getY() < _min.y - 1) || (point.getY() > _max.y + 1))
+		return false;
+
 	Math::Vector2d oldPoint(_polygon[_polygon.size() - 1]);
 	float oldSqDist = distanceSquared(oldPoint, point);
 
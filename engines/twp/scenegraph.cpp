@@ -219,16 +219,27 @@ static int cmpNodes(const NodeSort &x, const NodeSort &y) {
 }
 
 void Node::onDrawChildren(const Math::Matrix4 &trsf) {
-	// use this "stable sort" until there is something better available
-	Common::Array<NodeSort> children;
-	for (size_t i = 0; i < _children.size(); i++) {
-		children.push_back({i, _children[i]});
+	// most frames nothing has moved in z, then the children are already sorted
+	bool sorted = true;
+	for (size_t i = 1; i < _children.size(); i++) {
+		if (_children[i - 1]->getZSort() < _children[i]->getZSort()) {
+			sorted = false;
+			break;
+		}
 	}
-	Common::sort(children.begin(), children.end(), cmpNodes);
-	_children.clear();
-	_children.reserve(children.size());
-	for (size_t i = 0; i < children.size(); i++) {
-		_children.push_back(children[i].node);
+
+	if (!sorted) {
+		// use this "stable sort" until there is something better available
+		Common::Array<NodeSort> children;
+		for (size_t i = 0; i < _children.size(); i++) {
+			children.push_back({i, _children[i]});
+		}
+		Common::sort(children.begin(), children.end(), cmpNodes);
+		_children.clear();
+		_children.reserve(children.size());
+		for (size_t i = 0; i < children.size(); i++) {
+			_children.push_back(children[i].node);
+		}
 	}
 	for (auto &child : _children) {
 		child->draw(trsf);
@@ -268,6 +268,9 @@ bool XMeshOpenGLShader::renderFlatShadowModel(uint32 shadowColor) {
 bool XMeshOpenGLShader::update(FrameNode *parentFrame) {
 	XMesh::update(parentFrame);
 
+	if (!_blendedMeshChanged)
+		return true;
+
 	float *vertexData = (float *)_blendedMesh->getVertexBuffer().ptr();
 	uint32 vertexSize = DXGetFVFVertexSize(_blendedMesh->getFVF()) / sizeof(float);
 	uint32 vertexCount = _blendedMesh->getNumVertices();
@@ -50,8 +50,12 @@ XMesh::XMesh(Wintermute::BaseGame *inGame) : BaseNamedObject(inGame) {
 	_staticMesh = nullptr;
 
 	_boneMatrices = nullptr;
+	_lastBoneMatrices = nullptr;
 	_adjacency = nullptr;
 
+	_blendedMeshValid = false;
+	_blendedMeshChanged = false;
+
 	_BBoxStart = _BBoxEnd = DXVector3(0.0f, 0.0f, 0.0f);
 }
 
@@ -61,6 +65,7 @@ XMesh::~XMesh() {
 	SAFE_DELETE(_staticMesh);
 
 	SAFE_DELETE_ARRAY(_boneMatrices);
+	SAFE_DELETE_ARRAY(_lastBoneMatrices);
 	SAFE_DELETE_ARRAY(_adjacency);
 
 	_materials.removeAll();
@@ -93,6 +98,7 @@ bool XMesh::loadFromXData(const char *filename, XFileData *xobj) {
 	if (numBones) {
 		// bones are available
 		_boneMatrices = new DXMatrix*[numBones];
+		_lastBoneMatrices = new DXMatrix[numBones];
 
 		generateMesh();
 	} else {
@@ -148,6 +154,7 @@ bool XMesh::generateMesh() {
 	uint32 numFaces = _skinMesh->getNumFaces();
 
 	SAFE_DELETE(_blendedMesh);
+	_blendedMeshValid = false;
 
 	SAFE_DELETE_ARRAY(_adjacency);
 	_adjacency = new uint32[numFaces * 3];
@@ -184,22 +191,35 @@ bool XMesh::findBones(FrameNode *rootFrame) {
 
 //////////////////////////////////////////////////////////////////////////
 bool XMesh::update(FrameNode *parentFrame) {
+	_blendedMeshChanged = false;
+
 	if (!_blendedMesh)
 		return false;
 
 	// update skinned mesh
 	if (_skinMesh) {
 		int numBones = _skinMesh->getNumBones();
-		DXMatrix *boneMatrices = new DXMatrix[numBones];
+		bool poseChanged = !_blendedMeshValid;
 
 		// prepare final matrices
 		for (int i = 0; i < numBones; i++) {
-			DXMatrixMultiply(&boneMatrices[i], _skinMesh->getBoneOffsetMatrix(i), _boneMatrices[i]);
+			DXMatrix boneMatrix;
+			DXMatrixMultiply(&boneMatrix, _skinMesh->getBoneOffsetMatrix(i), _boneMatrices[i]);
+
+			if (poseChanged || memcmp(&boneMatrix, &_lastBoneMatrices[i], sizeof(DXMatrix)) != 0) {
+				_lastBoneMatrices[i] = boneMatrix;
+				poseChanged = true;
+			}
 		}
 
+		// the mesh still holds the skinned vertices of the same pose
+		if (!poseChanged)
+			return true;
+
 		// generate skinned mesh
-		_skinMesh->updateSkinnedMesh(boneMatrices, _blendedMesh);
-		delete[] boneMatrices;
+		_skinMesh->updateSkinnedMesh(_lastBoneMatrices, _blendedMesh);
+		_blendedMeshValid = true;
+		_blendedMeshChanged = true;
 
 		// update mesh bounding box
 		byte *points = _blendedMesh->getVertexBuffer().ptr();
@@ -234,6 +254,14 @@ bool XMesh::update(FrameNode *parentFrame) {
 			_BBoxEnd = DXVector3(maxX, maxY, maxZ);
 		}
 	} else {
+		const DXMatrix *parentMatrix = parentFrame->getCombinedMatrix();
+		if (_blendedMeshValid && memcmp(parentMatrix, &_lastParentMatrix, sizeof(DXMatrix)) == 0)
+			return true;
+
+		_lastParentMatrix = *parentMatrix;
+		_blendedMeshValid = true;
+		_blendedMeshChanged = true;
+
 		// update static mesh
 		uint32 fvfSize = DXGetFVFVertexSize(_blendedMesh->getFVF());
 		uint32 numVertices = _blendedMesh->getNumVertices();
@@ -80,6 +80,13 @@ protected:
 
 	DXMatrix **_boneMatrices;
 
+	// Skinning inputs of the last update, the blended mesh is only
+	// regenerated when the pose or the position of the mesh changes
+	DXMatrix *_lastBoneMatrices;
+	DXMatrix _lastParentMatrix;
+	bool _blendedMeshValid;
+	bool _blendedMeshChanged;
+
 	uint32 *_adjacency;
 
 	BaseArray<Material *> _materials;
@@ -33,6 +33,8 @@
 #include "engines/wintermute/base/gfx/xskinmesh.h"
 #include "engines/wintermute/base/gfx/xmath.h"
 
+#include "common/system.h"
+
 namespace Wintermute {
 
 struct MeshData {
@@ -385,64 +387,60 @@ void DXSkinInfo::destroy() {
 	_bones = nullptr;
 }
 
+DXSkinInfo::SkinInfluencesFunc DXSkinInfo::skinInfluences = nullptr;
+
 bool DXSkinInfo::updateSkinnedMesh(const DXMatrix *boneTransforms, void *srcVertices, void *dstVertices) {
 	uint32 vertexSize = DXGetFVFVertexSize(_fvf);
 	uint32 normalOffset = sizeof(DXVector3);
-	uint32 i, j;
+	uint32 i;
+
+	if (!skinInfluences) {
+		skinInfluences = skinInfluencesGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			skinInfluences = skinInfluencesNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			skinInfluences = skinInfluencesSSE2;
+#endif
+	}
+
+	const byte *src = (const byte *)srcVertices;
+	byte *dst = (byte *)dstVertices;
 
 	for (i = 0; i < _numVertices; i++) {
-		DXVector3 *position = (DXVector3 *)((byte *)dstVertices + vertexSize * i);
+		DXVector3 *position = (DXVector3 *)(dst + vertexSize * i);
 		position->_x = 0.0f;
 		position->_y = 0.0f;
 		position->_z = 0.0f;
 	}
 
 	for (i = 0; i < _numBones; i++) {
-		DXMatrix boneMatrix = boneTransforms[i];
-
-		for (j = 0; j < _bones[i]._numInfluences; j++) {
-			DXVector3 position;
-			DXVector3 *positionSrc = (DXVector3 *)((byte *)srcVertices + vertexSize * _bones[i]._vertices[j]);
-			DXVector3 *positionDst = (DXVector3 *)((byte *)dstVertices + vertexSize * _bones[i]._vertices[j]);
-			float weight = _bones[i]._weights[j];
-
-			DXVec3TransformCoord(&position, positionSrc, &boneMatrix);
-
-			positionDst->_x += weight * position._x;
-			positionDst->_y += weight * position._y;
-			positionDst->_z += weight * position._z;
-		}
+		skinInfluences(boneTransforms[i], _bones[i], src, dst, vertexSize, 0, false);
 	}
 
 	if (_fvf & DXFVF_NORMAL) {
 		for (i = 0; i < _numVertices; i++) {
-			DXVector3 *normal = (DXVector3 *)((byte *)dstVertices + vertexSize * i + normalOffset);
+			DXVector3 *normal = (DXVector3 *)(dst + vertexSize * i + normalOffset);
 			normal->_x = 0.0f;
 			normal->_y = 0.0f;
 			normal->_z = 0.0f;
 		}
 
 		for (i = 0; i < _numBones; i++) {
+			if (!_bones[i]._numInfluences)
+				continue;
+
 			DXMatrix boneInverse = boneTransforms[i];
 			DXMatrixInverse(&boneInverse, NULL, &boneInverse);
 			DXMatrixTranspose(&boneInverse, &boneInverse);
 
-			for (j = 0; j < _bones[i]._numInfluences; j++) {
-				DXVector3 normal;
-				DXVector3 *normalSrc = (DXVector3 *)((byte *)srcVertices + vertexSize * _bones[i]._vertices[j] + normalOffset);
-				DXVector3 *normalDst = (DXVector3 *)((byte *)dstVertices + vertexSize * _bones[i]._vertices[j] + normalOffset);
-				float weight = _bones[i]._weights[j];
-
-				DXVec3TransformNormal(&normal, normalSrc, &boneInverse);
-
-				normalDst->_x += weight * normal._x;
-				normalDst->_y += weight * normal._y;
-				normalDst->_z += weight * normal._z;
-			}
+			skinInfluences(boneInverse, _bones[i], src, dst, vertexSize, normalOffset, true);
 		}
 
 		for (i = 0; i < _numVertices; i++) {
-			DXVector3 *normalDest = (DXVector3 *)((byte *)dstVertices + (i * vertexSize) + normalOffset);
+			DXVector3 *normalDest = (DXVector3 *)(dst + (i * vertexSize) + normalOffset);
 			if ((normalDest->_x != 0.0f) && (normalDest->_y != 0.0f) && (normalDest->_z != 0.0f)) {
 				DXVec3Normalize(normalDest, normalDest);
 			}
@@ -452,6 +450,25 @@ bool DXSkinInfo::updateSkinnedMesh(const DXMatrix *boneTransforms, void *srcVert
 	return true;
 }
 
+void DXSkinInfo::skinInfluencesGeneric(const DXMatrix &transform, const DXBone &bone, const byte *srcVertices, byte *dstVertices,
+                                       uint32 vertexSize, uint32 offset, bool normals) {
+	for (uint32 j = 0; j < bone._numInfluences; j++) {
+		DXVector3 vec;
+		const DXVector3 *vecSrc = (const DXVector3 *)(srcVertices + vertexSize * bone._vertices[j] + offset);
+		DXVector3 *vecDst = (DXVector3 *)(dstVertices + vertexSize * bone._vertices[j] + offset);
+		float weight = bone._weights[j];
+
+		if (normals)
+			DXVec3TransformNormal(&vec, vecSrc, &transform);
+		else
+			DXVec3TransformCoord(&vec, vecSrc, &transform);
+
+		vecDst->_x += weight * vec._x;
+		vecDst->_y += weight * vec._y;
+		vecDst->_z += weight * vec._z;
+	}
+}
+
 bool DXSkinInfo::setBoneName(uint32 boneIdx, const char *name) {
 	if (boneIdx >= _numBones || !name)
 		return false;
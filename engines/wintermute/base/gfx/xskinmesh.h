@@ -122,6 +122,28 @@ public:
 	bool setBoneOffsetMatrix(uint32 boneIdx, const float *boneTransform);
 	DXMatrix *getBoneOffsetMatrix(uint32 boneIdx) { return &_bones[boneIdx]._transform; }
 	bool updateSkinnedMesh(const DXMatrix *boneTransforms, void *srcVertices, void *dstVertices);
+
+	/**
+	 * Adds the weighted influence of a bone to the vertices it affects.
+	 * The 3D vector at the given offset of each source vertex is transformed
+	 * as a point, or as a direction when normals is set, and accumulated
+	 * into the destination vertex.
+	 */
+	typedef void (*SkinInfluencesFunc)(const DXMatrix &transform, const DXBone &bone, const byte *srcVertices, byte *dstVertices,
+	                                   uint32 vertexSize, uint32 offset, bool normals);
+
+	static SkinInfluencesFunc skinInfluences;
+
+	static void skinInfluencesGeneric(const DXMatrix &transform, const DXBone &bone, const byte *srcVertices, byte *dstVertices,
+	                                  uint32 vertexSize, uint32 offset, bool normals);
+#ifdef SCUMMVM_SSE2
+	static void skinInfluencesSSE2(const DXMatrix &transform, const DXBone &bone, const byte *srcVertices, byte *dstVertices,
+	                               uint32 vertexSize, uint32 offset, bool normals);
+#endif
+#ifdef SCUMMVM_NEON
+	static void skinInfluencesNEON(const DXMatrix &transform, const DXBone &bone, const byte *srcVertices, byte *dstVertices,
+	                               uint32 vertexSize, uint32 offset, bool normals);
+#endif
 };
 
 class DXMesh {
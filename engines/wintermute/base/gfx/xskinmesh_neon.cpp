@@ -0,0 +1,96 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "engines/wintermute/base/gfx/xskinmesh.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Wintermute {
+
+static inline float32x4_t loadVec3(const float *src) {
+	return vcombine_f32(vld1_f32(src), vld1_lane_f32(src + 2, vdup_n_f32(0.0f), 0));
+}
+
+static inline void storeVec3(float *dst, float32x4_t v) {
+	vst1_f32(dst, vget_low_f32(v));
+	vst1q_lane_f32(dst + 2, v, 2);
+}
+
+static inline float32x4_t transformVec3(float32x4_t r0, float32x4_t r1, float32x4_t r2, const float *src) {
+	float32x4_t res = vmulq_n_f32(r0, src[0]);
+	res = vaddq_f32(res, vmulq_n_f32(r1, src[1]));
+	return vaddq_f32(res, vmulq_n_f32(r2, src[2]));
+}
+
+void DXSkinInfo::skinInfluencesNEON(const DXMatrix &transform, const DXBone &bone, const byte *srcVertices, byte *dstVertices,
+                                    uint32 vertexSize, uint32 offset, bool normals) {
+	// Bone matrices are affine in practice, the projective divide done by
+	// DXVec3TransformCoord() is only needed for the odd one that is not
+	if (!normals && (transform._m[0][3] != 0.0f || transform._m[1][3] != 0.0f ||
+	                 transform._m[2][3] != 0.0f || transform._m[3][3] != 1.0f)) {
+		skinInfluencesGeneric(transform, bone, srcVertices, dstVertices, vertexSize, offset, normals);
+		return;
+	}
+
+	const float32x4_t r0 = vld1q_f32(transform._m[0]);
+	const float32x4_t r1 = vld1q_f32(transform._m[1]);
+	const float32x4_t r2 = vld1q_f32(transform._m[2]);
+	const float32x4_t r3 = normals ? vdupq_n_f32(0.0f) : vld1q_f32(transform._m[3]);
+
+	for (uint32 j = 0; j < bone._numInfluences; j++) {
+		const float *src = (const float *)(srcVertices + vertexSize * bone._vertices[j] + offset);
+		float *dst = (float *)(dstVertices + vertexSize * bone._vertices[j] + offset);
+
+		float32x4_t vec = vaddq_f32(transformVec3(r0, r1, r2, src), r3);
+		vec = vmulq_n_f32(vec, bone._weights[j]);
+		storeVec3(dst, vaddq_f32(loadVec3(dst), vec));
+	}
+}
+
+} // namespace Wintermute
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,91 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "engines/wintermute/base/gfx/xskinmesh.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Wintermute {
+
+static inline __m128 loadVec3(const float *src) {
+	__m128 xy = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)src);
+	return _mm_movelh_ps(xy, _mm_load_ss(src + 2));
+}
+
+static inline void storeVec3(float *dst, __m128 v) {
+	_mm_storel_pi((__m64 *)dst, v);
+	_mm_store_ss(dst + 2, _mm_movehl_ps(v, v));
+}
+
+static inline __m128 transformVec3(__m128 r0, __m128 r1, __m128 r2, const float *src) {
+	__m128 res = _mm_mul_ps(r0, _mm_set1_ps(src[0]));
+	res = _mm_add_ps(res, _mm_mul_ps(r1, _mm_set1_ps(src[1])));
+	return _mm_add_ps(res, _mm_mul_ps(r2, _mm_set1_ps(src[2])));
+}
+
+void DXSkinInfo::skinInfluencesSSE2(const DXMatrix &transform, const DXBone &bone, const byte *srcVertices, byte *dstVertices,
+                                    uint32 vertexSize, uint32 offset, bool normals) {
+	// Bone matrices are affine in practice, the projective divide done by
+	// DXVec3TransformCoord() is only needed for the odd one that is not
+	if (!normals && (transform._m[0][3] != 0.0f || transform._m[1][3] != 0.0f ||
+	                 transform._m[2][3] != 0.0f || transform._m[3][3] != 1.0f)) {
+		skinInfluencesGeneric(transform, bone, srcVertices, dstVertices, vertexSize, offset, normals);
+		return;
+	}
+
+	const __m128 r0 = _mm_loadu_ps(transform._m[0]);
+	const __m128 r1 = _mm_loadu_ps(transform._m[1]);
+	const __m128 r2 = _mm_loadu_ps(transform._m[2]);
+	const __m128 r3 = normals ? _mm_setzero_ps() : _mm_loadu_ps(transform._m[3]);
+
+	for (uint32 j = 0; j < bone._numInfluences; j++) {
+		const float *src = (const float *)(srcVertices + vertexSize * bone._vertices[j] + offset);
+		float *dst = (float *)(dstVertices + vertexSize * bone._vertices[j] + offset);
+
+		__m128 vec = _mm_add_ps(transformVec3(r0, r1, r2, src), r3);
+		vec = _mm_mul_ps(vec, _mm_set1_ps(bone._weights[j]));
+		storeVec3(dst, _mm_add_ps(loadVec3(dst), vec));
+	}
+}
+
+} // namespace Wintermute
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
@@ -203,6 +203,15 @@ MODULE_OBJS += \
 	base/gfx/tinygl/shadow_volume_tinygl.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	base/gfx/xskinmesh_neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	base/gfx/xskinmesh_sse2.o
+endif
+
 endif
 
 
@@ -296,6 +296,15 @@ public:
 	 */
 	virtual void setGradientColors(uint8 r1, uint8 g1, uint8 b1, uint8 r2, uint8 g2, uint8 b2) = 0;
 
+	/**
+	 * Retrieves the active colors, which the drawing steps that do not set
+	 * their own colors draw with.
+	 *
+	 * @param colors	receives the foreground, background, bevel, gradient
+	 *					start and gradient end colors
+	 */
+	virtual void getColors(uint32 colors[5]) const = 0;
+
 	/**
 	 * Sets the active drawing surface. All drawing from this
 	 * point on will be done on that surface.
@@ -494,6 +503,14 @@ public:
 	 */
 	virtual void drawStep(const Common::Rect &area, const Common::Rect &clip, const DrawStep &step, uint32 extra = 0);
 
+	/**
+	 * Sets up the renderer state for the specified draw step, the same way
+	 * drawStep does, without drawing anything.
+	 *
+	 * @see drawStep
+	 */
+	void setStepState(const Common::Rect &area, const Common::Rect &clip, const DrawStep &step, uint32 extra = 0);
+
 	/**
 	 * Copies the part of the current frame to the system overlay.
 	 *
@@ -126,6 +126,19 @@ ifdef USE_HQ_SCALERS
 MODULE_OBJS += \
 	scaler/hq.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	scaler/hq-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	scaler/hq-sse2.o
+endif
+ifdef SCUMMVM_AVX2
+MODULE_OBJS += \
+	scaler/hq-avx2.o
+endif
+
 ifdef USE_NASM
 MODULE_OBJS += \
 	scaler/hq2x_i386.o \
@@ -0,0 +1,81 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+#include "common/endian.h"
+
+#include "graphics/scaler/hq.h"
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+/**
+ * All bits set in the lanes where the Yuv values are close enough, matching
+ * diffYUV. The components are bytes, so their absolute differences are
+ * computed with saturating subtractions and checked against the V, U and Y
+ * thresholds in one go.
+ */
+static FORCEINLINE __m256i similarYUV(__m256i a, __m256i b) {
+	const __m256i thresholds = _mm256_set1_epi32((int)0xFF300706);
+	__m256i absDiff = _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+	return _mm256_cmpeq_epi32(_mm256_subs_epu8(absDiff, thresholds), _mm256_setzero_si256());
+}
+
+#define PATTERN_BIT(row, offset, bit) \
+	pattern = _mm256_or_si256(pattern, _mm256_andnot_si256(similarYUV(yuv5, _mm256_loadu_si256((const __m256i *)(row + i + offset))), _mm256_set1_epi32(bit)))
+
+void HQScaler::computePatternsAVX2(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width) {
+	int i = 0;
+	for (; i + 8 <= width; i += 8) {
+		const __m256i yuv5 = _mm256_loadu_si256((const __m256i *)(yuvRow + i + 1));
+		__m256i pattern = _mm256_setzero_si256();
+		PATTERN_BIT(yuvAbove, 0, 0x01);
+		PATTERN_BIT(yuvAbove, 1, 0x02);
+		PATTERN_BIT(yuvAbove, 2, 0x04);
+		PATTERN_BIT(yuvRow,   0, 0x08);
+		PATTERN_BIT(yuvRow,   2, 0x10);
+		PATTERN_BIT(yuvBelow, 0, 0x20);
+		PATTERN_BIT(yuvBelow, 1, 0x40);
+		PATTERN_BIT(yuvBelow, 2, 0x80);
+
+		// The packs work within each 128-bit lane, leaving 4 patterns at the start of both
+		pattern = _mm256_packs_epi32(pattern, pattern);
+		pattern = _mm256_packus_epi16(pattern, pattern);
+		WRITE_UINT32(patterns + i, _mm_cvtsi128_si32(_mm256_castsi256_si128(pattern)));
+		WRITE_UINT32(patterns + i + 4, _mm_cvtsi128_si32(_mm256_extracti128_si256(pattern, 1)));
+	}
+
+	computePatternsGeneric(yuvAbove + i, yuvRow + i, yuvBelow + i, patterns + i, width - i);
+}
+
+#undef PATTERN_BIT
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
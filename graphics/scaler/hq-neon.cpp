@@ -0,0 +1,89 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "graphics/scaler/hq.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+/**
+ * All bits set in the lanes where the Yuv values are close enough, matching
+ * diffYUV. The components are bytes, so their absolute differences are
+ * checked against the V, U and Y thresholds in one go.
+ */
+static inline uint32x4_t similarYUV(uint32x4_t a, uint32x4_t b) {
+	const uint8x16_t thresholds = vreinterpretq_u8_u32(vdupq_n_u32(0xFF300706));
+	uint8x16_t over = vcgtq_u8(vabdq_u8(vreinterpretq_u8_u32(a), vreinterpretq_u8_u32(b)), thresholds);
+	return vceqq_u32(vreinterpretq_u32_u8(over), vdupq_n_u32(0));
+}
+
+#define PATTERN_BIT(row, offset, bit) \
+	pattern = vorrq_u32(pattern, vbicq_u32(vdupq_n_u32(bit), similarYUV(yuv5, vld1q_u32(row + i + offset))))
+
+void HQScaler::computePatternsNEON(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width) {
+	int i = 0;
+	for (; i + 4 <= width; i += 4) {
+		const uint32x4_t yuv5 = vld1q_u32(yuvRow + i + 1);
+		uint32x4_t pattern = vdupq_n_u32(0);
+		PATTERN_BIT(yuvAbove, 0, 0x01);
+		PATTERN_BIT(yuvAbove, 1, 0x02);
+		PATTERN_BIT(yuvAbove, 2, 0x04);
+		PATTERN_BIT(yuvRow,   0, 0x08);
+		PATTERN_BIT(yuvRow,   2, 0x10);
+		PATTERN_BIT(yuvBelow, 0, 0x20);
+		PATTERN_BIT(yuvBelow, 1, 0x40);
+		PATTERN_BIT(yuvBelow, 2, 0x80);
+
+		uint16x4_t pattern16 = vmovn_u32(pattern);
+		uint8x8_t pattern8 = vmovn_u16(vcombine_u16(pattern16, pattern16));
+		vst1_lane_u32((uint32 *)(patterns + i), vreinterpret_u32_u8(pattern8), 0);
+	}
+
+	computePatternsGeneric(yuvAbove + i, yuvRow + i, yuvBelow + i, patterns + i, width - i);
+}
+
+#undef PATTERN_BIT
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
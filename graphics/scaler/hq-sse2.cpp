@@ -0,0 +1,87 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+#include "common/endian.h"
+
+#include "graphics/scaler/hq.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+/**
+ * All bits set in the lanes where the Yuv values are close enough, matching
+ * diffYUV. The components are bytes, so their absolute differences are
+ * computed with saturating subtractions and checked against the V, U and Y
+ * thresholds in one go.
+ */
+static FORCEINLINE __m128i similarYUV(__m128i a, __m128i b) {
+	const __m128i thresholds = _mm_set1_epi32((int)0xFF300706);
+	__m128i absDiff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+	return _mm_cmpeq_epi32(_mm_subs_epu8(absDiff, thresholds), _mm_setzero_si128());
+}
+
+#define PATTERN_BIT(row, offset, bit) \
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(row + i + offset))), _mm_set1_epi32(bit)))
+
+void HQScaler::computePatternsSSE2(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width) {
+	int i = 0;
+	for (; i + 4 <= width; i += 4) {
+		const __m128i yuv5 = _mm_loadu_si128((const __m128i *)(yuvRow + i + 1));
+		__m128i pattern = _mm_setzero_si128();
+		PATTERN_BIT(yuvAbove, 0, 0x01);
+		PATTERN_BIT(yuvAbove, 1, 0x02);
+		PATTERN_BIT(yuvAbove, 2, 0x04);
+		PATTERN_BIT(yuvRow,   0, 0x08);
+		PATTERN_BIT(yuvRow,   2, 0x10);
+		PATTERN_BIT(yuvBelow, 0, 0x20);
+		PATTERN_BIT(yuvBelow, 1, 0x40);
+		PATTERN_BIT(yuvBelow, 2, 0x80);
+
+		pattern = _mm_packs_epi32(pattern, pattern);
+		pattern = _mm_packus_epi16(pattern, pattern);
+		WRITE_UINT32(patterns + i, _mm_cvtsi128_si32(pattern));
+	}
+
+	computePatternsGeneric(yuvAbove + i, yuvRow + i, yuvBelow + i, patterns + i, width - i);
+}
+
+#undef PATTERN_BIT
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
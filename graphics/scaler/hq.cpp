@@ -22,6 +22,8 @@
 #include "graphics/scaler.h"
 #include "graphics/scaler/intern.h"
 
+#include "common/system.h"
+
 // RGB-to-YUV lookup table
 
 #ifdef USE_NASM
@@ -173,7 +175,17 @@ void HQScaler::initLUT(Graphics::PixelFormat format) {
 #define PIXEL11_90	*(q+1+nextlineDst) = interpolate_2_3_3(w5, w6, w8);
 #define PIXEL11_100	*(q+1+nextlineDst) = interpolate_14_1_1(w5, w6, w8);
 
-#define YUV(x)	(sizeof(Pixel) == 2 ? RGBtoYUV[w ## x] : ConvertYUV<ColorMask>(w ## x, RGBtoYUV))
+// YUV values of the 3x3 neighbourhood, taken from the converted rows around pixel i
+#define YUV(x)	YUV_ ## x
+#define YUV_1	yuvAbove[i]
+#define YUV_2	yuvAbove[i + 1]
+#define YUV_3	yuvAbove[i + 2]
+#define YUV_4	yuvRow[i]
+#define YUV_5	yuvRow[i + 1]
+#define YUV_6	yuvRow[i + 2]
+#define YUV_7	yuvBelow[i]
+#define YUV_8	yuvBelow[i + 1]
+#define YUV_9	yuvBelow[i + 2]
 
 /**
  * Convert 32 bit RGB values to Yuv
@@ -193,13 +205,41 @@ static inline uint32 ConvertYUV(uint32 x, const uint32 *RGBtoYUV) {
 	return RGBtoYUV[r | g | b];
 }
 
+/**
+ * Convert a row of pixels to Yuv
+ */
+template<typename ColorMask>
+static inline void ConvertRowYUV(const typename ColorMask::PixelType *p, uint32 *yuv, int count, const uint32 *RGBtoYUV) {
+	for (int i = 0; i < count; i++)
+		yuv[i] = (sizeof(typename ColorMask::PixelType) == 2) ? RGBtoYUV[p[i]] : ConvertYUV<ColorMask>(p[i], RGBtoYUV);
+}
+
+HQScaler::PatternFunc HQScaler::computePatterns = nullptr;
+
+void HQScaler::computePatternsGeneric(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width) {
+	for (int i = 0; i < width; i++) {
+		const int yuv5 = YUV(5);
+		int pattern = 0;
+		if (diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
+		if (diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
+		if (diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
+		if (diffYUV(yuv5, YUV(4))) pattern |= 0x0008;
+		if (diffYUV(yuv5, YUV(6))) pattern |= 0x0010;
+		if (diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
+		if (diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
+		if (diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
+		patterns[i] = pattern;
+	}
+}
+
 /*
  * The HQ2x high quality 2x graphics filter.
  * Original author Maxim Stepin (https://web.archive.org/web/20090204033742/http://www.hiend3d.com/hq2x.html).
  * Adapted for ScummVM to 16 bit output and optimized by Max Horn.
  */
 template<typename ColorMask>
-static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, const uint32 *RGBtoYUV) {
+static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, const uint32 *RGBtoYUV,
+                                 uint32 *yuvRows, uint8 *patterns) {
 	typedef typename ColorMask::PixelType Pixel;
 
 	int w1, w2, w3, w4, w5, w6, w7, w8, w9;
@@ -221,7 +261,17 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 	//	 | w7 | w8 | w9 |
 	//	 +----+----+----+
 
+	// Yuv rows above, at and below the current one, starting one pixel to the left
+	uint32 *yuvAbove = yuvRows;
+	uint32 *yuvRow = yuvAbove + width + 2;
+	uint32 *yuvBelow = yuvRow + width + 2;
+	ConvertRowYUV<ColorMask>(p - 1 - nextlineSrc, yuvAbove, width + 2, RGBtoYUV);
+	ConvertRowYUV<ColorMask>(p - 1, yuvRow, width + 2, RGBtoYUV);
+
 	while (height--) {
+		ConvertRowYUV<ColorMask>(p - 1 + nextlineSrc, yuvBelow, width + 2, RGBtoYUV);
+		HQScaler::computePatterns(yuvAbove, yuvRow, yuvBelow, patterns, width);
+
 		w1 = *(p - 1 - nextlineSrc);
 		w4 = *(p - 1);
 		w7 = *(p - 1 + nextlineSrc);
@@ -238,16 +288,8 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
-			const int yuv5 = YUV(5);
-			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
-			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
-			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
-			if (w5 != w4 && diffYUV(yuv5, YUV(4))) pattern |= 0x0008;
-			if (w5 != w6 && diffYUV(yuv5, YUV(6))) pattern |= 0x0010;
-			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
-			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
-			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
+			const int i = width - 1 - tmpWidth;
+			const int pattern = patterns[i];
 
 			switch (pattern) {
 			case 0:
@@ -2052,6 +2094,11 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			q += 2;
 		}
 		p += nextlineSrc - width;
+
+		uint32 *yuvTmp = yuvAbove;
+		yuvAbove = yuvRow;
+		yuvRow = yuvBelow;
+		yuvBelow = yuvTmp;
 		q += (nextlineDst - width) * 2;
 	}
 }
@@ -2116,7 +2163,8 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
  * Adapted for ScummVM to 16 bit output and optimized by Max Horn.
  */
 template<typename ColorMask>
-static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, const uint32 *RGBtoYUV) {
+static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, const uint32 *RGBtoYUV,
+                                 uint32 *yuvRows, uint8 *patterns) {
 	typedef typename ColorMask::PixelType Pixel;
 
 	int  w1, w2, w3, w4, w5, w6, w7, w8, w9;
@@ -2139,7 +2187,17 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 	//	 | w7 | w8 | w9 |
 	//	 +----+----+----+
 
+	// Yuv rows above, at and below the current one, starting one pixel to the left
+	uint32 *yuvAbove = yuvRows;
+	uint32 *yuvRow = yuvAbove + width + 2;
+	uint32 *yuvBelow = yuvRow + width + 2;
+	ConvertRowYUV<ColorMask>(p - 1 - nextlineSrc, yuvAbove, width + 2, RGBtoYUV);
+	ConvertRowYUV<ColorMask>(p - 1, yuvRow, width + 2, RGBtoYUV);
+
 	while (height--) {
+		ConvertRowYUV<ColorMask>(p - 1 + nextlineSrc, yuvBelow, width + 2, RGBtoYUV);
+		HQScaler::computePatterns(yuvAbove, yuvRow, yuvBelow, patterns, width);
+
 		w1 = *(p - 1 - nextlineSrc);
 		w4 = *(p - 1);
 		w7 = *(p - 1 + nextlineSrc);
@@ -2156,16 +2214,8 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
-			const int yuv5 = YUV(5);
-			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
-			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
-			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
-			if (w5 != w4 && diffYUV(yuv5, YUV(4))) pattern |= 0x0008;
-			if (w5 != w6 && diffYUV(yuv5, YUV(6))) pattern |= 0x0010;
-			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
-			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
-			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
+			const int i = width - 1 - tmpWidth;
+			const int pattern = patterns[i];
 
 			switch (pattern) {
 			case 0:
@@ -4943,6 +4993,11 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			q += 3;
 		}
 		p += nextlineSrc - width;
+
+		uint32 *yuvTmp = yuvAbove;
+		yuvAbove = yuvRow;
+		yuvRow = yuvBelow;
+		yuvBelow = yuvTmp;
 		q += (nextlineDst - width) * 3;
 	}
 }
@@ -4987,19 +5042,19 @@ void HQScaler::HQ3x16(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint3
 void HQScaler::HQ2x16(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
 	if (_format.gLoss == 2)
 		HQ2x_implementation<Graphics::ColorMasks<565> >(srcPtr, srcPitch, dstPtr,
-				dstPitch, width, height, _RGBtoYUV);
+				dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 	else
 		HQ2x_implementation<Graphics::ColorMasks<555> >(srcPtr, srcPitch, dstPtr,
-				dstPitch, width, height, _RGBtoYUV);
+				dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 }
 
 void HQScaler::HQ3x16(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
 	if (_format.gLoss == 2)
 		HQ3x_implementation<Graphics::ColorMasks<565> >(srcPtr, srcPitch, dstPtr,
-				dstPitch, width, height, _RGBtoYUV);
+				dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 	else
 		HQ3x_implementation<Graphics::ColorMasks<555> >(srcPtr, srcPitch, dstPtr,
-				dstPitch, width, height, _RGBtoYUV);
+				dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 }
 #endif
 
@@ -5007,15 +5062,15 @@ void HQScaler::HQ2x32(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint3
 	if (_format.aLoss == 0) {
 		if (_format.aShift == 0) {
 			HQ2x_implementation<Graphics::ColorMasks<-8888> >(srcPtr, srcPitch, dstPtr,
-					dstPitch, width, height, _RGBtoYUV);
+					dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 		} else {
 			HQ2x_implementation<Graphics::ColorMasks<8888> >(srcPtr, srcPitch, dstPtr,
-					dstPitch, width, height, _RGBtoYUV);
+					dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 		}
 	} else {
 		assert((_format.rMax() | _format.gMax() | _format.bMax()) <= 0xffffff);
 		HQ2x_implementation<Graphics::ColorMasks<888> >(srcPtr, srcPitch, dstPtr,
-				dstPitch, width, height, _RGBtoYUV);
+				dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 	}
 }
 
@@ -5023,20 +5078,39 @@ void HQScaler::HQ3x32(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint3
 	if (_format.aLoss == 0) {
 		if (_format.aShift == 0) {
 			HQ3x_implementation<Graphics::ColorMasks<-8888> >(srcPtr, srcPitch, dstPtr,
-					dstPitch, width, height, _RGBtoYUV);
+					dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 		} else {
 			HQ3x_implementation<Graphics::ColorMasks<8888> >(srcPtr, srcPitch, dstPtr,
-					dstPitch, width, height, _RGBtoYUV);
+					dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 		}
 	} else {
 		assert((_format.rMax() | _format.gMax() | _format.bMax()) <= 0xffffff);
 		HQ3x_implementation<Graphics::ColorMasks<888> >(srcPtr, srcPitch, dstPtr,
-				dstPitch, width, height, _RGBtoYUV);
+				dstPitch, width, height, _RGBtoYUV, _yuvRows.data(), _patterns.data());
 	}
 }
 
 void HQScaler::scaleIntern(const uint8 *srcPtr, uint32 srcPitch,
 							uint8 *dstPtr, uint32 dstPitch, int width, int height, int x, int y) {
+	// If no function has been selected yet, detect and select
+	if (!computePatterns) {
+		computePatterns = computePatternsGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) computePatterns = computePatternsNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) computePatterns = computePatternsSSE2;
+#endif
+#ifdef SCUMMVM_AVX2
+		if (g_system->hasFeature(OSystem::kFeatureCpuAVX2)) computePatterns = computePatternsAVX2;
+#endif
+	}
+
+	if (_yuvRows.size() < 3 * (uint)(width + 2)) {
+		_yuvRows.resize(3 * (width + 2));
+		_patterns.resize(width);
+	}
+
 	if (_format.bytesPerPixel == 2) {
 		switch (_factor) {
 		case 2:
@@ -21,6 +21,7 @@
 #ifndef GRAPHICS_SCALER_HQ_H
 #define GRAPHICS_SCALER_HQ_H
 
+#include "common/array.h"
 #include "graphics/scalerplugin.h"
 
 #ifdef USE_NASM
@@ -33,6 +34,30 @@ public:
 	~HQScaler();
 	uint increaseFactor() override;
 	uint decreaseFactor() override;
+
+	/**
+	 * Compute the neighbour patterns of a row of pixels. Bit n of a pattern is
+	 * set when the pixel differs noticeably (see diffYUV) from its n-th
+	 * neighbour, in the order top-left, top, top-right, left, right,
+	 * bottom-left, bottom, bottom-right. The Yuv rows hold width + 2 values,
+	 * starting one pixel to the left of the row.
+	 */
+	typedef void (*PatternFunc)(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width);
+
+	/** The pattern function in use, selected on first use when not set */
+	static PatternFunc computePatterns;
+
+	static void computePatternsGeneric(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width);
+#ifdef SCUMMVM_NEON
+	static void computePatternsNEON(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width);
+#endif
+#ifdef SCUMMVM_SSE2
+	static void computePatternsSSE2(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width);
+#endif
+#ifdef SCUMMVM_AVX2
+	static void computePatternsAVX2(const uint32 *yuvAbove, const uint32 *yuvRow, const uint32 *yuvBelow, uint8 *patterns, int width);
+#endif
+
 protected:
 	virtual void scaleIntern(const uint8 *srcPtr, uint32 srcPitch,
 							uint8 *dstPtr, uint32 dstPitch, int width, int height, int x, int y) override;
@@ -44,6 +69,11 @@ protected:
 	inline void HQ3x32(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height);
 
 	uint32 *_RGBtoYUV;
+
+	// Scratch rows shared by every call, so scale() is not reentrant and
+	// one HQScaler must not scale several rects at the same time.
+	Common::Array<uint32> _yuvRows;
+	Common::Array<uint8> _patterns;
 #ifdef USE_NASM
 	hqx_parameters *_hqx_params;
 #endif
@@ -83,6 +83,9 @@ struct WidgetDrawData {
 	uint16 _backgroundOffset;
 	uint16 _shadowOffset;
 
+	/** False when a step draws regardless of the widget area, e.g. filling the whole surface */
+	bool _cacheable;
+
 	DrawLayer _layer;
 
 
@@ -96,6 +99,20 @@ struct WidgetDrawData {
 	void calcBackgroundOffset();
 };
 
+/** A DrawData rendering, along with the pixels it was drawn over */
+struct CachedDrawData {
+	Graphics::Surface before;
+	Graphics::Surface after;
+
+	~CachedDrawData() {
+		before.free();
+		after.free();
+	}
+};
+
+/** Memory budget of the cached DrawData renderings */
+static const uint32 kDrawDataCacheBudget = 4 * 1024 * 1024;
+
 /**********************************************************
  *  Data definitions for theme engine elements
  *********************************************************/
@@ -233,6 +250,8 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_cursorFormat = Graphics::PixelFormat::createFormatCLUT8();
 	_cursorPalSize = 0;
 
+	_drawDataCacheSize = 0;
+
 	// We prefer files in archive bundles over the common search paths.
 	_themeFiles.add("default", &SearchMan, 0, false);
 }
@@ -245,6 +264,7 @@ ThemeEngine::~ThemeEngine() {
 
 	unloadTheme();
 	unloadExtraFont();
+	clearDrawDataCache();
 
 	// Release all graphics surfaces
 	for (auto &bitmap : _bitmaps) {
@@ -464,6 +484,8 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
 
+	clearDrawDataCache();
+
 	// Since we reinitialized our screen surfaces we know nothing has been
 	// drawn so far. Sometimes we still end up with dirty screen bits in the
 	// list. Clearing it avoids invalid overlay writes when the backend
@@ -473,8 +495,12 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 
 void WidgetDrawData::calcBackgroundOffset() {
 	uint maxShadow = 0, maxBevel = 0;
+	_cacheable = true;
 	for (Common::List<Graphics::DrawStep>::const_iterator step = _steps.begin();
 	        step != _steps.end(); ++step) {
+		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_FILLSURFACE)
+			_cacheable = false;
+
 		if ((step->autoWidth || step->autoHeight) && step->shadow > maxShadow)
 			maxShadow = step->shadow;
 
@@ -747,6 +773,7 @@ bool ThemeEngine::addDrawData(const Common::String &data, bool cached) {
 		delete _widgets[id];
 
 	_widgets[id] = new WidgetDrawData;
+	_widgets[id]->_cacheable = false;
 	_widgets[id]->_layer = kDrawDataDefaults[id].layer;
 	_widgets[id]->_textDataId = kTextDataNone;
 
@@ -789,6 +816,8 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearDrawDataCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = nullptr;
@@ -916,6 +945,28 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 /**********************************************************
  * Draw Date descriptors drawing functions
  *********************************************************/
+static bool stepDrawsWithin(Graphics::VectorRenderer *renderer, const Graphics::DrawStep &step, const Common::Rect &area, const Common::Rect &bounds) {
+	if (step.drawingCall == &Graphics::VectorRenderer::drawCallback_VOID)
+		return true;
+
+	uint16 x, y, w, h;
+	renderer->stepGetPositions(step, area, x, y, w, h);
+
+	if (step.drawingCall == &Graphics::VectorRenderer::drawCallback_BITMAP) {
+		if (!step.blitSrc)
+			return false;
+		w = step.blitSrc->w;
+		h = step.blitSrc->h;
+	} else if (step.drawingCall == &Graphics::VectorRenderer::drawCallback_CIRCLE) {
+		w = h = 2 * renderer->stepGetRadius(step, area);
+	}
+
+	Common::Rect stepArea(x, y, x + w, y + h);
+	stepArea.right += step.shadow;
+	stepArea.bottom += step.shadow;
+	return bounds.contains(stepArea);
+}
+
 void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, bool forceRestore) {
 	WidgetDrawData *drawData = _widgets[type];
 
@@ -935,6 +986,18 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		extendedRect.bottom += drawData->_shadowOffset - drawData->_backgroundOffset;
 	}
 
+	// Renderings are only cached when nothing gets clipped, and the steps
+	// cannot draw differently
+	bool cacheable = drawData->_cacheable && area == r &&
+		Common::Rect(_screen.w, _screen.h).contains(extendedRect) &&
+		(_clip.isEmpty() || _clip.contains(extendedRect)) &&
+		2U * extendedRect.width() * extendedRect.height() * _screen.format.bytesPerPixel <= kDrawDataCacheBudget / 4;
+
+	// The cached pixels only cover extendedRect, so each step has to stay inside it
+	for (Common::List<Graphics::DrawStep>::const_iterator step = drawData->_steps.begin(); cacheable && step != drawData->_steps.end(); ++step) {
+		cacheable = stepDrawsWithin(_vectorRenderer, *step, area, extendedRect);
+	}
+
 	if (!_clip.isEmpty()) {
 		extendedRect.clip(_clip);
 	}
@@ -949,14 +1012,95 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 
 	if (drawData->_layer == _layerToDraw) {
 		Common::List<Graphics::DrawStep>::const_iterator step;
+		DrawDataCacheKey key;
+
+		if (cacheable) {
+			key.type = type;
+			key.dynamic = dynamic;
+			key.width = area.width();
+			key.height = area.height();
+			key.flags = (area.left & 1) | ((area.top & 1) << 1) | (_clip.isEmpty() << 2);
+			_vectorRenderer->getColors(key.colors);
+
+			if (drawCachedDD(key, extendedRect)) {
+				// Leave the renderer as drawing the steps would
+				for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+					_vectorRenderer->setStepState(area, _clip, *step, dynamic);
+				}
+
+				addDirtyRect(extendedRect);
+				return;
+			}
+
+			// Keep the pixels the item is drawn over in a scratch surface, reused between misses
+			const Graphics::Surface before = _vectorRenderer->getActiveSurface()->rawSurface().getSubArea(extendedRect);
+			if (_drawDataBefore.w != before.w || _drawDataBefore.h != before.h || _drawDataBefore.format != before.format)
+				_drawDataBefore.create(before.w, before.h, before.format);
+			_drawDataBefore.copyRectToSurface(before, 0, 0, Common::Rect(before.w, before.h));
+		}
+
 		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
 			_vectorRenderer->drawStep(area, _clip, *step, dynamic);
 		}
 
+		if (cacheable)
+			cacheDD(key, extendedRect);
+
 		addDirtyRect(extendedRect);
 	}
 }
 
+bool ThemeEngine::drawCachedDD(const DrawDataCacheKey &key, const Common::Rect &r) {
+	DrawDataCache::const_iterator entry = _drawDataCache.find(key);
+	if (entry == _drawDataCache.end())
+		return false;
+
+	Graphics::ManagedSurface *surface = _vectorRenderer->getActiveSurface();
+	const Graphics::Surface &before = entry->_value->before;
+	const uint rowSize = r.width() * surface->format.bytesPerPixel;
+
+	for (int y = 0; y < r.height(); ++y) {
+		if (memcmp(surface->getBasePtr(r.left, r.top + y), before.getBasePtr(0, y), rowSize))
+			return false;
+	}
+
+	surface->copyRectToSurface(entry->_value->after, r.left, r.top, Common::Rect(r.width(), r.height()));
+	return true;
+}
+
+void ThemeEngine::cacheDD(const DrawDataCacheKey &key, const Common::Rect &r) {
+	const Graphics::Surface after = _vectorRenderer->getActiveSurface()->rawSurface().getSubArea(r);
+
+	// Replace the rendering over other pixels, if any. The key holds the
+	// size, so the surfaces of the entry can be overwritten in place.
+	DrawDataCache::iterator old = _drawDataCache.find(key);
+	if (old != _drawDataCache.end()) {
+		old->_value->before.copyRectToSurface(_drawDataBefore, 0, 0, Common::Rect(r.width(), r.height()));
+		old->_value->after.copyRectToSurface(after, 0, 0, Common::Rect(r.width(), r.height()));
+		return;
+	}
+
+	const uint32 size = 2 * after.pitch * after.h;
+	if (_drawDataCacheSize + size > kDrawDataCacheBudget)
+		clearDrawDataCache();
+
+	CachedDrawData *entry = new CachedDrawData;
+	entry->before.copyFrom(_drawDataBefore);
+	entry->after.copyFrom(after);
+
+	_drawDataCache[key] = entry;
+	_drawDataCacheSize += size;
+}
+
+void ThemeEngine::clearDrawDataCache() {
+	for (auto &entry : _drawDataCache)
+		delete entry._value;
+
+	_drawDataCache.clear();
+	_drawDataCacheSize = 0;
+	_drawDataBefore.free();
+}
+
 void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::U32String &text,
 	bool restoreBg, bool ellipsis, Graphics::TextAlign alignH, TextAlignVertical alignV,
 	int deltax, const Common::Rect &drawableTextArea) {
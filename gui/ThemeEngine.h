@@ -48,6 +48,7 @@ class VectorRenderer;
 namespace GUI {
 
 struct WidgetDrawData;
+struct CachedDrawData;
 struct TextDrawData;
 class Dialog;
 class GuiObject;
@@ -661,6 +662,49 @@ public:
 	 */
 	void restoreBackground(Common::Rect r);
 
+	/**
+	 * Identifies a rendering of a DrawData item in _drawDataCache. Besides the
+	 * item and its size, the result depends on the dithering phase of the
+	 * position, the colors left active in the renderer and the clipping.
+	 */
+	struct DrawDataCacheKey {
+		DrawData type;
+		uint32 dynamic;
+		int16 width, height;
+		byte flags;
+		uint32 colors[5];
+
+		bool operator==(const DrawDataCacheKey &other) const {
+			return type == other.type && dynamic == other.dynamic && width == other.width &&
+			       height == other.height && flags == other.flags && !memcmp(colors, other.colors, sizeof(colors));
+		}
+	};
+
+	struct DrawDataCacheKey_Hash {
+		uint operator()(const DrawDataCacheKey &key) const {
+			uint hash = key.type ^ (key.dynamic * 31) ^ (key.width << 16) ^ key.height ^ (key.flags << 12);
+			for (int i = 0; i < ARRAYSIZE(key.colors); i++)
+				hash = hash * 33 + key.colors[i];
+			return hash;
+		}
+	};
+
+	typedef Common::HashMap<DrawDataCacheKey, CachedDrawData *, DrawDataCacheKey_Hash> DrawDataCache;
+
+	/**
+	 * Replays a cached rendering of a DrawData item over the given rect, if
+	 * it was rendered over the same pixels before.
+	 */
+	bool drawCachedDD(const DrawDataCacheKey &key, const Common::Rect &r);
+
+	/**
+	 * Stores the rendering of a DrawData item over the given rect, along with
+	 * the previous contents of the rect kept in _drawDataBefore.
+	 */
+	void cacheDD(const DrawDataCacheKey &key, const Common::Rect &r);
+
+	void clearDrawDataCache();
+
 	const Common::String &getThemeName() const { return _themeName; }
 	const Common::String &getThemeId() const { return _themeId; }
 	int getGraphicsMode() const { return _graphicsMode; }
@@ -801,6 +845,12 @@ protected:
 	Common::Array<LangExtraFont> _langExtraFonts;
 
 	ImagesMap _bitmaps;
+
+	/** Renderings of DrawData items, replayed when drawn again at the same size over the same pixels */
+	DrawDataCache _drawDataCache;
+	uint32 _drawDataCacheSize;
+	/** Pixels under the DrawData item being rendered, until it is cached */
+	Graphics::Surface _drawDataBefore;
 	Graphics::PixelFormat _overlayFormat;
 	Graphics::PixelFormat _cursorFormat;
 
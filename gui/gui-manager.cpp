@@ -61,6 +61,9 @@ GuiManager::GuiManager() : CommandSender(nullptr), _redrawStatus(kRedrawDisabled
 	_system = g_system;
 	_lastScreenChangeID = _system->getScreenChangeID();
 
+	_redrawStatsStart = _system->getMillis(true);
+	_redrawTimeTotal = _redrawTimeMax = _redrawCount = 0;
+
 	computeScaleFactor();
 
 	_launched = false;
@@ -475,6 +478,8 @@ void GuiManager::redraw() {
 	if (_dialogStack.empty())
 		return;
 
+	const uint32 redrawStart = _system->getMillis(true);
+
 	if (_displayTopDialogOnly) {
 		redrawInternalTopDialogOnly();
 	} else {
@@ -483,6 +488,18 @@ void GuiManager::redraw() {
 
 	_theme->updateScreen();
 	_redrawStatus = kRedrawDisabled;
+
+	const uint32 redrawEnd = _system->getMillis(true);
+	_redrawTimeTotal += redrawEnd - redrawStart;
+	_redrawTimeMax = MAX(_redrawTimeMax, redrawEnd - redrawStart);
+	_redrawCount++;
+
+	if (redrawEnd - _redrawStatsStart >= 1000) {
+		debug(5, "GUI redraw: %u frames, %.2f ms average, %u ms max", _redrawCount,
+		      (double)_redrawTimeTotal / _redrawCount, _redrawTimeMax);
+		_redrawStatsStart = redrawEnd;
+		_redrawTimeTotal = _redrawTimeMax = _redrawCount = 0;
+	}
 }
 
 Dialog *GuiManager::getTopDialog() const {
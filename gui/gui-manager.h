@@ -170,6 +170,10 @@ protected:
 
 //	bool		_needRedraw;
 	RedrawStatus _redrawStatus;
+
+	// Redraw timings, reported at debug level 5 about once per second
+	uint32		_redrawStatsStart, _redrawTimeTotal, _redrawTimeMax, _redrawCount;
+
 	int			_lastScreenChangeID;
 	int16		_baseWidth, _baseHeight;
 	float		_scaleFactor;
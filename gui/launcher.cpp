@@ -1008,6 +1008,7 @@ public:
 
 	void handleCommand(CommandSender *sender, uint32 cmd, uint32 data) override;
 	void handleKeyDown(Common::KeyState state) override;
+	void handleTickle() override;
 
 	LauncherDisplayType getType() const override { return kLauncherDisplayGrid; }
 
@@ -1552,6 +1553,13 @@ void LauncherGrid::handleKeyDown(Common::KeyState state) {
 	updateButtons();
 }
 
+void LauncherGrid::handleTickle() {
+	// Thumbnails are decoded a few at a time so that scrolling stays responsive
+	if (_grid)
+		_grid->loadPendingThumbnails();
+	LauncherDialog::handleTickle();
+}
+
 void LauncherGrid::handleCommand(CommandSender *sender, uint32 cmd, uint32 data) {
 
 	switch (cmd) {
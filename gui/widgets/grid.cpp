@@ -33,6 +33,13 @@
 
 namespace GUI {
 
+enum {
+	// Time spent decoding thumbnails per call before deferring the rest to the next tickle
+	kThumbnailLoadBudget = 20,
+	// Number of decoded thumbnails kept around once they are no longer visible
+	kMaxCachedThumbnails = 256
+};
+
 GridItemWidget::GridItemWidget(GridWidget *boss)
 	: ContainerWidget(boss, 0, 0, 0, 0), CommandSender(boss) {
 
@@ -445,6 +452,10 @@ GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
 
 	_selectedEntry = nullptr;
 	_isGridInvalid = true;
+
+	_thumbnailStamp = 0;
+	_pendingThumbnails = false;
+	_filterIndexValid = false;
 }
 
 GridWidget::~GridWidget() {
@@ -452,6 +463,8 @@ GridWidget::~GridWidget() {
 	unloadSurfaces(_languageIcons);
 	unloadSurfaces(_extraIcons);
 	unloadSurfaces(_loadedSurfaces);
+	_loadedSurfacesStamp.clear();
+	_missingSurfaces.clear();
 	delete _disabledIconOverlay;
 	_gridItems.clear();
 	_dataEntryList.clear();
@@ -474,7 +487,7 @@ void GridWidget::unloadSurfaces(Common::HashMap<T, const Graphics::ManagedSurfac
 const Graphics::ManagedSurface *GridWidget::filenameToSurface(const Common::String &name) {
 	if (name.empty())
 		return nullptr;
-	return _loadedSurfaces[name];
+	return _loadedSurfaces.getValOrDefault(name, nullptr);
 }
 
 const Graphics::ManagedSurface *GridWidget::languageToSurface(Common::Language languageCode, Graphics::AlphaType &alphaType) {
@@ -507,11 +520,17 @@ void GridWidget::setEntryList(Common::Array<GridItemInfo> *list) {
 	_headerEntryList.clear();
 	_sortedEntryList.clear();
 	_visibleEntryList.clear();
+	_lowercaseTitles.clear();
+	_filterIndexValid = false;
 	_isGridInvalid = true;
 	_selectedEntry = nullptr;
 
 	for (Common::Array<GridItemInfo>::iterator entryIter = list->begin(); entryIter != list->end(); ++entryIter) {
 		_dataEntryList.push_back(*entryIter);
+
+		Common::U32String title(entryIter->title);
+		title.toLowercase();
+		_lowercaseTitles.push_back(title);
 	}
 	// TODO: Remove this below, add drawWidget(), that should do the drawing
 	if (!_gridItems.empty()) {
@@ -552,6 +571,17 @@ void GridWidget::groupEntries() {
 	sortGroups();
 }
 
+// Returns true if filter is prev with more characters appended.
+static bool filterExtends(const Common::U32String &filter, const Common::U32String &prev) {
+	if (filter.size() < prev.size())
+		return false;
+	for (uint i = 0; i < prev.size(); ++i) {
+		if (filter[i] != prev[i])
+			return false;
+	}
+	return true;
+}
+
 void GridWidget::sortGroups() {
 	uint oldHeight = _innerHeight;
 	_sortedEntryList.clear();
@@ -589,28 +619,41 @@ void GridWidget::sortGroups() {
 		// Restrict the list to everything which contains all words in _filter
 		// as substrings, ignoring case.
 
+		// Appending to the filter can only narrow its tokens down, so when the
+		// previous filter is a prefix of the new one only its matches are rescanned.
+		Common::Array<int> candidates;
+		if (_filterIndexValid && filterExtends(_filter, _filterIndexFilter)) {
+			candidates.swap(_filterIndex);
+		} else {
+			candidates.resize(_dataEntryList.size());
+			for (uint i = 0; i < candidates.size(); ++i)
+				candidates[i] = i;
+		}
+
 		Common::U32StringTokenizer tok(_filter);
-		Common::U32String tmp;
-		int n = 0;
 
 		_sortedEntryList.clear();
+		_filterIndex.clear();
 
-		for (GridItemInfo *i = _dataEntryList.begin(); i != _dataEntryList.end(); ++i, ++n) {
-			tmp = i->title;
-			tmp.toLowercase();
+		for (uint i = 0; i < candidates.size(); ++i) {
+			const int n = candidates[i];
 			bool matches = true;
 			tok.reset();
 			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
+				if (!_lowercaseTitles[n].contains(tok.nextToken())) {
 					matches = false;
 					break;
 				}
 			}
 
 			if (matches) {
-				_sortedEntryList.push_back(i);
+				_sortedEntryList.push_back(&_dataEntryList[n]);
+				_filterIndex.push_back(n);
 			}
 		}
+
+		_filterIndexFilter = _filter;
+		_filterIndexValid = true;
 	}
 
 	calcEntrySizes();
@@ -697,48 +740,120 @@ void GridWidget::setGroupHeaderFormat(const Common::U32String &prefix, const Com
 	_groupHeaderSuffix = suffix;
 }
 
-void GridWidget::reloadThumbnails() {
+void GridWidget::loadThumbnail(const GridItemInfo *entry) {
 	const int thumbnailWidth = MAX(_thumbnailWidth - 2 * _thumbnailMargin, 0);
 	const int thumbnailHeight = MAX(_thumbnailHeight - 2 * _thumbnailMargin, 0);
+
+	Common::String path = Common::String::format("icons/%s-%s.png", entry->engineid.c_str(), entry->gameid.c_str());
+	Graphics::ManagedSurface *surf = loadSurfaceFromFile(path);
+	if (!surf) {
+		path = Common::String::format("icons/%s.png", entry->engineid.c_str());
+		if (!_loadedSurfaces.contains(path)) {
+			if (!_missingSurfaces.contains(path))
+				surf = loadSurfaceFromFile(path);
+		} else {
+			const Graphics::ManagedSurface *scSurf = _loadedSurfaces[path];
+			// TODO: Use SharedPtr instead of duplicating the surface
+			Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
+			thSurf->copyFrom(*scSurf);
+			_loadedSurfaces[entry->thumbPath] = thSurf;
+		}
+	}
+
+	if (surf) {
+		const Graphics::ManagedSurface *scSurf(scaleGfx(surf, thumbnailWidth, thumbnailHeight, true));
+		_loadedSurfaces[entry->thumbPath] = scSurf;
+
+		if (path != entry->thumbPath) {
+			// TODO: Use SharedPtr instead of duplicating the surface
+			Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
+			thSurf->copyFrom(*scSurf);
+			_loadedSurfaces[path] = thSurf;
+			_loadedSurfacesStamp[path] = _thumbnailStamp;
+		}
+
+		if (surf != scSurf) {
+			surf->free();
+			delete surf;
+		}
+	}
+
+	if (!_loadedSurfaces.contains(entry->thumbPath)) {
+		_missingSurfaces[entry->thumbPath] = true;
+		_missingSurfaces[path] = true;
+	}
+}
+
+void GridWidget::reloadThumbnails() {
+	// Decoding every visible thumbnail at once stalls the launcher on large
+	// collections, so only spend kThumbnailLoadBudget here and leave the rest
+	// to loadPendingThumbnails(). Items without a thumbnail show their title meanwhile.
+	const uint32 deadline = g_system->getMillis() + kThumbnailLoadBudget;
+
+	_thumbnailStamp++;
+	_pendingThumbnails = false;
+
 	for (Common::Array<GridItemInfo *>::iterator iter = _visibleEntryList.begin(); iter != _visibleEntryList.end(); ++iter) {
 		GridItemInfo *entry = *iter;
 		if (entry->thumbPath.empty())
 			continue;
 
+		if (_missingSurfaces.contains(entry->thumbPath))
+			continue;
+
 		if (!_loadedSurfaces.contains(entry->thumbPath)) {
-			_loadedSurfaces[entry->thumbPath] = nullptr;
-			Common::String path = Common::String::format("icons/%s-%s.png", entry->engineid.c_str(), entry->gameid.c_str());
-			Graphics::ManagedSurface *surf = loadSurfaceFromFile(path);
-			if (!surf) {
-				path = Common::String::format("icons/%s.png", entry->engineid.c_str());
-				if (!_loadedSurfaces.contains(path)) {
-					surf = loadSurfaceFromFile(path);
-				} else {
-					const Graphics::ManagedSurface *scSurf = _loadedSurfaces[path];
-					// TODO: Use SharedPtr instead of duplicating the surface
-					Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
-					thSurf->copyFrom(*scSurf);
-					_loadedSurfaces[entry->thumbPath] = thSurf;
-				}
+			if ((int32)(g_system->getMillis() - deadline) >= 0) {
+				_pendingThumbnails = true;
+				continue;
 			}
+			loadThumbnail(entry);
+			if (!_loadedSurfaces.contains(entry->thumbPath))
+				continue;
+		}
+		_loadedSurfacesStamp[entry->thumbPath] = _thumbnailStamp;
+	}
 
-			if (surf) {
-				const Graphics::ManagedSurface *scSurf(scaleGfx(surf, thumbnailWidth, thumbnailHeight, true));
-				_loadedSurfaces[entry->thumbPath] = scSurf;
+	evictThumbnails();
+}
 
-				if (path != entry->thumbPath) {
-					// TODO: Use SharedPtr instead of duplicating the surface
-					Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
-					thSurf->copyFrom(*scSurf);
-					_loadedSurfaces[path] = thSurf;
-				}
+void GridWidget::loadPendingThumbnails() {
+	if (!_pendingThumbnails)
+		return;
 
-				if (surf != scSurf) {
-					surf->free();
-					delete surf;
-				}
-			}
-		}
+	reloadThumbnails();
+
+	for (uint k = 0; k < _gridItems.size() && k < _visibleEntryList.size(); ++k) {
+		_gridItems[k]->update();
+	}
+}
+
+void GridWidget::evictThumbnails() {
+	if (_loadedSurfaces.size() <= kMaxCachedThumbnails)
+		return;
+
+	// Drop the images which have been off screen for the longest time
+	Common::Array<uint32> stamps;
+	for (Common::HashMap<Common::String, uint32>::const_iterator i = _loadedSurfacesStamp.begin(); i != _loadedSurfacesStamp.end(); ++i) {
+		if (i->_value != _thumbnailStamp)
+			stamps.push_back(i->_value);
+	}
+
+	const uint excess = _loadedSurfaces.size() - kMaxCachedThumbnails;
+	if (stamps.empty())
+		return;
+	Common::sort(stamps.begin(), stamps.end());
+	const uint32 threshold = stamps[MIN<uint>(excess, stamps.size()) - 1];
+
+	Common::Array<Common::String> evicted;
+	for (Common::HashMap<Common::String, uint32>::const_iterator i = _loadedSurfacesStamp.begin(); i != _loadedSurfacesStamp.end(); ++i) {
+		if (i->_value <= threshold && i->_value != _thumbnailStamp)
+			evicted.push_back(i->_key);
+	}
+
+	for (uint i = 0; i < evicted.size(); ++i) {
+		delete _loadedSurfaces.getValOrDefault(evicted[i], nullptr);
+		_loadedSurfaces.erase(evicted[i]);
+		_loadedSurfacesStamp.erase(evicted[i]);
 	}
 }
 
@@ -1073,6 +1188,8 @@ void GridWidget::reflowLayout() {
 		unloadSurfaces(_platformIcons);
 		unloadSurfaces(_languageIcons);
 		unloadSurfaces(_loadedSurfaces);
+		_loadedSurfacesStamp.clear();
+		_missingSurfaces.clear();
 		_platformIconsAlpha.clear();
 		_languageIconsAlpha.clear();
 		_extraIconsAlpha.clear();
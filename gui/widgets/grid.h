@@ -108,12 +108,24 @@ protected:
 	Graphics::ManagedSurface *_disabledIconOverlay;
 	// Images are mapped by filename -> surface.
 	Common::HashMap<Common::String, const Graphics::ManagedSurface *> _loadedSurfaces;
+	// Stamp of the last time each loaded image was visible, used to evict the oldest ones
+	Common::HashMap<Common::String, uint32> _loadedSurfacesStamp;
+	// Images which failed to load, so that they are not searched for again
+	Common::HashMap<Common::String, bool> _missingSurfaces;
+	uint32			_thumbnailStamp;
+	bool			_pendingThumbnails;
 
 	Common::Array<GridItemInfo>			_dataEntryList;
 	Common::Array<GridItemInfo>			_headerEntryList;
 	Common::Array<GridItemInfo *>		_sortedEntryList;
 	Common::Array<GridItemInfo *>		_visibleEntryList;
 
+	// Lowercased titles of _dataEntryList, and the entries matching _filterIndexFilter
+	Common::Array<Common::U32String>	_lowercaseTitles;
+	Common::Array<int>					_filterIndex;
+	Common::U32String					_filterIndexFilter;
+	bool								_filterIndexValid;
+
 	Common::String							_groupingAttribute;
 	Common::HashMap<Common::U32String, int>	_groupValueIndex;
 	Common::Array<bool>						_groupExpanded;
@@ -156,6 +168,9 @@ protected:
 	int				_gridHeaderWidth;
 	int				_trayHeight;
 
+	void loadThumbnail(const GridItemInfo *entry);
+	void evictThumbnails();
+
 public:
 	int				_gridItemHeight;
 	int				_gridItemWidth;
@@ -198,6 +213,8 @@ public:
 	void saveClosedGroups(const Common::U32String &groupName);
 
 	void reloadThumbnails();
+	/// Continue loading the thumbnails left over by reloadThumbnails(), to be called periodically.
+	void loadPendingThumbnails();
 	void loadFlagIcons();
 	void loadPlatformIcons();
 	void loadExtraIcons();
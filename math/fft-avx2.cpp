@@ -0,0 +1,80 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "math/fft.h"
+#include "math/utils.h"
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace Math {
+
+/** Swap the real and imaginary parts of all four complex values */
+static FORCEINLINE __m256 swapReIm(__m256 a) {
+	return _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+void FFT::transformPassAVX2(Complex *z, const float *wre, const float *wim, int n) {
+	float *z0 = &z[0].re;
+	float *z1 = &z[n].re;
+	float *z2 = &z[2 * n].re;
+	float *z3 = &z[3 * n].re;
+	const __m256 negRe = _mm256_set_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+
+	// Four complex values at a time, n is a multiple of 8
+	for (int k = 0; k < 2 * n; k += 8) {
+		const __m256 wr = _mm256_loadu_ps(wre + k);
+		const __m256 wi = _mm256_loadu_ps(wim + k);
+		const __m256 a2 = _mm256_loadu_ps(z2 + k);
+		const __m256 a3 = _mm256_loadu_ps(z3 + k);
+
+		// a2 * conj(w) and a3 * w
+		const __m256 t12 = _mm256_sub_ps(_mm256_mul_ps(a2, wr), _mm256_mul_ps(swapReIm(a2), wi));
+		const __m256 t56 = _mm256_add_ps(_mm256_mul_ps(a3, wr), _mm256_mul_ps(swapReIm(a3), wi));
+
+		const __m256 sum = _mm256_add_ps(t12, t56);
+		// The difference times i
+		const __m256 diff = _mm256_xor_ps(swapReIm(_mm256_sub_ps(t56, t12)), negRe);
+
+		const __m256 a0 = _mm256_loadu_ps(z0 + k);
+		const __m256 a1 = _mm256_loadu_ps(z1 + k);
+		_mm256_storeu_ps(z0 + k, _mm256_add_ps(a0, sum));
+		_mm256_storeu_ps(z2 + k, _mm256_sub_ps(a0, sum));
+		_mm256_storeu_ps(z1 + k, _mm256_add_ps(a1, diff));
+		_mm256_storeu_ps(z3 + k, _mm256_sub_ps(a1, diff));
+	}
+}
+
+} // End of namespace Math
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
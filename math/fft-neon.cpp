@@ -0,0 +1,88 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "math/fft.h"
+#include "math/utils.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Math {
+
+void FFT::transformPassNEON(Complex *z, const float *wre, const float *wim, int n) {
+	float *z0 = &z[0].re;
+	float *z1 = &z[n].re;
+	float *z2 = &z[2 * n].re;
+	float *z3 = &z[3 * n].re;
+	const float negReValues[4] = { -1.0f, 1.0f, -1.0f, 1.0f };
+	const float32x4_t negRe = vld1q_f32(negReValues);
+
+	// Two complex values at a time, n is a multiple of 8
+	for (int k = 0; k < 2 * n; k += 4) {
+		const float32x4_t wr = vld1q_f32(wre + k);
+		const float32x4_t wi = vld1q_f32(wim + k);
+		const float32x4_t a2 = vld1q_f32(z2 + k);
+		const float32x4_t a3 = vld1q_f32(z3 + k);
+
+		// a2 * conj(w) and a3 * w
+		const float32x4_t t12 = vsubq_f32(vmulq_f32(a2, wr), vmulq_f32(vrev64q_f32(a2), wi));
+		const float32x4_t t56 = vaddq_f32(vmulq_f32(a3, wr), vmulq_f32(vrev64q_f32(a3), wi));
+
+		const float32x4_t sum = vaddq_f32(t12, t56);
+		// The difference times i
+		const float32x4_t diff = vmulq_f32(vrev64q_f32(vsubq_f32(t56, t12)), negRe);
+
+		const float32x4_t a0 = vld1q_f32(z0 + k);
+		const float32x4_t a1 = vld1q_f32(z1 + k);
+		vst1q_f32(z0 + k, vaddq_f32(a0, sum));
+		vst1q_f32(z2 + k, vsubq_f32(a0, sum));
+		vst1q_f32(z1 + k, vaddq_f32(a1, diff));
+		vst1q_f32(z3 + k, vsubq_f32(a1, diff));
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
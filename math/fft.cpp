@@ -28,6 +28,7 @@
 #include "math/fft.h"
 #include "math/cosinetables.h"
 #include "math/utils.h"
+#include "common/system.h"
 #include "common/util.h"
 
 namespace Math {
@@ -55,6 +56,36 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 		else
 			_cosTables[i] = nullptr;
 	}
+
+	for (int i = 0; i < ARRAYSIZE(_twiddles); i++) {
+		if (i + 5 <= _bits) {
+			const int quarter = 1 << (i + 3);
+			const float *cosTable = _cosTables[i + 1]->getTable();
+
+			float *wre = _twiddles[i] = new float[quarter * 4];
+			float *wim = wre + quarter * 2;
+			for (int k = 0; k < quarter; k++) {
+				wre[2 * k] = wre[2 * k + 1] = cosTable[k];
+				wim[2 * k] = -cosTable[quarter - k];
+				wim[2 * k + 1] = cosTable[quarter - k];
+			}
+		} else
+			_twiddles[i] = nullptr;
+	}
+
+	// If no function has been selected yet, detect and select
+	if (!transformPass) {
+		transformPass = transformPassGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) transformPass = transformPassNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) transformPass = transformPassSSE2;
+#endif
+#ifdef SCUMMVM_AVX2
+		if (g_system->hasFeature(OSystem::kFeatureCpuAVX2)) transformPass = transformPassAVX2;
+#endif
+	}
 }
 
 FFT::~FFT() {
@@ -62,6 +93,10 @@ FFT::~FFT() {
 		delete _cosTables[i];
 	}
 
+	for (int i = 0; i < ARRAYSIZE(_twiddles); i++) {
+		delete[] _twiddles[i];
+	}
+
 	delete[] _revTab;
 	delete[] _expTab;
 	delete[] _tmpBuf;
@@ -154,25 +189,17 @@ int FFT::splitRadixPermutation(int i, int n, int inverse) {
 	BUTTERFLIES(a0, a1, a2, a3) \
 }
 
-/* z[0...8n-1], w[1...2n-1] */
+/* z[0...4n-1], w[1...n-1] */
 #define PASS(name) \
-static void name(Complex *z, const float *wre, unsigned int n) { \
+static void name(Complex *z, const float *wre, const float *wim, int n) { \
 	float t1, t2, t3, t4, t5, t6; \
-	int o1 = 2 * n; \
-	int o2 = 4 * n; \
-	int o3 = 6 * n; \
-	const float *wim = wre + o1; \
-	n--; \
+	int o1 = n; \
+	int o2 = 2 * n; \
+	int o3 = 3 * n; \
 	\
 	TRANSFORM_ZERO(z[0], z[o1], z[o2], z[o3]); \
-	TRANSFORM(z[1], z[o1 + 1], z[o2 + 1], z[o3 + 1], wre[1], wim[-1]); \
-	do { \
-		z += 2; \
-		wre += 2; \
-		wim -= 2; \
-		TRANSFORM(z[0], z[o1], z[o2], z[o3], wre[0], wim[0]);\
-		TRANSFORM(z[1], z[o1 + 1], z[o2 + 1], z[o3 + 1], wre[1], wim[-1]);\
-	} while(--n);\
+	for (int k = 1; k < n; k++) \
+		TRANSFORM(z[k], z[o1 + k], z[o2 + k], z[o3 + k], wre[2 * k], wim[2 * k + 1]); \
 }
 
 PASS(pass)
@@ -180,6 +207,15 @@ PASS(pass)
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+FFT::PassFunc FFT::transformPass = nullptr;
+
+void FFT::transformPassGeneric(Complex *z, const float *wre, const float *wim, int n) {
+	if (n > 256)
+		pass_big(z, wre, wim, n);
+	else
+		pass(z, wre, wim, n);
+}
+
 void FFT::fft4(Complex *z) {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
 
@@ -243,11 +279,8 @@ void FFT::fft(int n, int logn, Complex *z) {
 		fft((n / 2), logn - 1, z);
 		fft((n / 4), logn - 2, z + (n / 4) * 2);
 		fft((n / 4), logn - 2, z + (n / 4) * 3);
-		assert(_cosTables[logn - 4]);
-		if (n > 1024)
-			pass_big(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
-		else
-			pass(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+		assert(_twiddles[logn - 5]);
+		transformPass(z, _twiddles[logn - 5], _twiddles[logn - 5] + n / 2, n / 4);
 	}
 }
 
@@ -67,6 +67,31 @@ public:
 	 */
 	void calc(Complex *z);
 
+	/**
+	 * One split-radix pass, combining the 2n point transform in z[0...2n-1]
+	 * with the two n point transforms in z[2n...3n-1] and z[3n...4n-1].
+	 *
+	 * The twiddle factors are laid out so that they can be loaded straight
+	 * into vector registers: wre holds the cosine of factor k twice, at
+	 * wre[2k] and wre[2k + 1], and wim holds its sine negated at wim[2k]
+	 * and as is at wim[2k + 1].
+	 */
+	typedef void (*PassFunc)(Complex *z, const float *wre, const float *wim, int n);
+
+	/** The pass function in use, selected on first use when not set */
+	static PassFunc transformPass;
+
+	static void transformPassGeneric(Complex *z, const float *wre, const float *wim, int n);
+#ifdef SCUMMVM_NEON
+	static void transformPassNEON(Complex *z, const float *wre, const float *wim, int n);
+#endif
+#ifdef SCUMMVM_SSE2
+	static void transformPassSSE2(Complex *z, const float *wre, const float *wim, int n);
+#endif
+#ifdef SCUMMVM_AVX2
+	static void transformPassAVX2(Complex *z, const float *wre, const float *wim, int n);
+#endif
+
 private:
 	int _bits;
 	int _inverse;
@@ -82,6 +107,9 @@ private:
 
 	CosineTable *_cosTables[13];
 
+	/** The twiddle factors of the passes of 32 points and up, see PassFunc */
+	float *_twiddles[12];
+
 	void fft4(Complex *z);
 	void fft8(Complex *z);
 	void fft16(Complex *z);
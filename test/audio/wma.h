@@ -0,0 +1,181 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+#include "test/instrset_detect.h"
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/random.h"
+#include "common/system.h"
+
+#include "audio/decoders/util.h"
+#include "audio/decoders/wma.h"
+
+#include "../null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
+
+class WMAVectorTestSuite : public CxxTest::TestSuite {
+	// A WMA frame at 44.1kHz, plus a few values to exercise the scalar tails
+	static const int kLength = 2048 + 7;
+
+	struct Funcs {
+		const char *name;
+		Audio::WMACodec::FMulAddFunc fmulAdd;
+		Audio::WMACodec::FMulReverseFunc fmulReverse;
+		Audio::WMACodec::ToInt16Func toInt16;
+	};
+
+	static Common::Array<Funcs> vectorFuncs() {
+		Common::Array<Funcs> funcs;
+#ifdef SCUMMVM_NEON
+		Funcs neon = { "NEON", Audio::WMACodec::vectorFMulAddNEON, Audio::WMACodec::vectorFMulReverseNEON, Audio::WMACodec::toInt16InterleaveNEON };
+		funcs.push_back(neon);
+#endif
+#ifdef SCUMMVM_SSE2
+		if (instrset_detect() >= 2) {
+			Funcs sse2 = { "SSE2", Audio::WMACodec::vectorFMulAddSSE2, Audio::WMACodec::vectorFMulReverseSSE2, Audio::WMACodec::toInt16InterleaveSSE2 };
+			funcs.push_back(sse2);
+		}
+#endif
+		return funcs;
+	}
+
+	static void fillFloats(float *dst, int len, Common::RandomSource &rnd, float scale) {
+		for (int i = 0; i < len; i++)
+			dst[i] = ((int)rnd.getRandomNumber(20000) - 10000) * scale;
+	}
+
+public:
+	void test_vector_functions() {
+		Common::RandomSource rnd("wma");
+		float src0[kLength], src1[kLength], src2[kLength];
+		float expected[kLength], output[kLength];
+		fillFloats(src0, kLength, rnd, 0.001f);
+		fillFloats(src1, kLength, rnd, 0.001f);
+		fillFloats(src2, kLength, rnd, 0.001f);
+
+		Common::Array<Funcs> funcs = vectorFuncs();
+		for (uint f = 0; f < funcs.size(); f++) {
+			for (int len = kLength - 7; len <= kLength; len++) {
+				Audio::WMACodec::vectorFMulAddGeneric(expected, src0, src1, src2, len);
+				funcs[f].fmulAdd(output, src0, src1, src2, len);
+				TS_ASSERT_SAME_DATA(expected, output, len * sizeof(float));
+
+				// In place, as the windowing does it
+				memcpy(output, src2, len * sizeof(float));
+				funcs[f].fmulAdd(output, src0, src1, output, len);
+				TS_ASSERT_SAME_DATA(expected, output, len * sizeof(float));
+
+				Audio::WMACodec::vectorFMulReverseGeneric(expected, src0, src1, len);
+				funcs[f].fmulReverse(output, src0, src1, len);
+				TS_ASSERT_SAME_DATA(expected, output, len * sizeof(float));
+			}
+		}
+	}
+
+	void test_int16_conversion() {
+		Common::RandomSource rnd("wma");
+		float left[kLength], right[kLength];
+
+		// Out of range values and exact halves, where the rounding is easy to get wrong.
+		// Values beyond the int range are left out, floatToInt16() is undefined for them.
+		fillFloats(left, kLength, rnd, 4.0f);
+		fillFloats(right, kLength, rnd, 0.5f);
+		const float special[] = { 0.5f, -0.5f, 1.5f, -1.5f, 2.5f, -2.5f, 0.49999997f, -0.49999997f,
+		                          32766.5f, 32767.5f, -32767.5f, -32768.5f, 0.0f, -0.0f };
+		for (int i = 0; i < ARRAYSIZE(special); i++) {
+			left[i] = special[i];
+			right[ARRAYSIZE(special) - 1 - i] = special[i];
+		}
+
+		int16 expected[kLength * 2], output[kLength * 2];
+		const float *src[2] = { left, right };
+
+		Common::Array<Funcs> funcs = vectorFuncs();
+		for (uint f = 0; f < funcs.size(); f++) {
+			for (uint8 channels = 1; channels <= 2; channels++) {
+				for (int len = kLength - 7; len <= kLength; len++) {
+					Audio::floatToInt16Interleave(expected, src, len, channels);
+					funcs[f].toInt16(output, src, len, channels);
+					TS_ASSERT_SAME_DATA(expected, output, len * channels * sizeof(int16));
+				}
+			}
+		}
+	}
+
+	void test_frame_throughput() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+
+		Common::RandomSource rnd("wma");
+		const int frameLen = 2048;
+		float *output = new float[frameLen * 2];
+		float *window = new float[frameLen];
+		float *frameOut[2] = { new float[frameLen * 2], new float[frameLen * 2] };
+		int16 *pcm = new int16[frameLen * 2];
+		fillFloats(output, frameLen * 2, rnd, 3.0f);
+		fillFloats(window, frameLen, rnd, 0.0001f);
+
+#ifdef SLOW_TESTS
+		const int frames = 100000;
+#else
+		const int frames = 2000;
+#endif
+
+		Common::Array<Funcs> funcs = vectorFuncs();
+		Funcs generic = { "generic", Audio::WMACodec::vectorFMulAddGeneric, Audio::WMACodec::vectorFMulReverseGeneric, Audio::WMACodec::toInt16InterleaveGeneric };
+		funcs.insert_at(0, generic);
+
+		for (uint f = 0; f < funcs.size(); f++) {
+			memset(frameOut[0], 0, frameLen * 2 * sizeof(float));
+			memset(frameOut[1], 0, frameLen * 2 * sizeof(float));
+
+			// The per frame vector work of a stereo stream with long blocks:
+			// windowing and overlap-add, then conversion to PCM
+			uint32 start = g_system->getMillis();
+			for (int n = 0; n < frames; n++) {
+				for (int c = 0; c < 2; c++) {
+					funcs[f].fmulAdd(frameOut[c], output, window, frameOut[c], frameLen);
+					funcs[f].fmulReverse(frameOut[c] + frameLen, output + frameLen, window, frameLen);
+				}
+				funcs[f].toInt16(pcm, const_cast<const float **>(frameOut), frameLen, 2);
+			}
+			uint32 time = g_system->getMillis() - start;
+
+			debug("WMA %s: %.0f stereo frames/s", funcs[f].name, frames * 1000.0 / MAX<uint32>(time, 1));
+		}
+
+		delete[] pcm;
+		delete[] frameOut[1];
+		delete[] frameOut[0];
+		delete[] window;
+		delete[] output;
+#endif
+	}
+};
@@ -0,0 +1,85 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/endian.h"
+#include "engines/glk/glulx/undo_chain.h"
+
+/**
+ * Test suite for the undo state bookkeeping of the Glulx interpreter
+ */
+class GlulxUndoChainTestSuite : public CxxTest::TestSuite {
+	/* Builds a state with the given chunk lengths, the way perform_saveundo() lays it out */
+	static byte *makeEntry(uint memlen, uint heaplen, uint stacklen) {
+		byte *entry = (byte *)malloc(12 + memlen + heaplen + stacklen);
+		memset(entry, 0, 12 + memlen + heaplen + stacklen);
+		WRITE_BE_UINT32(entry, memlen);
+		WRITE_BE_UINT32(entry + 4 + memlen, heaplen);
+		WRITE_BE_UINT32(entry + 8 + memlen + heaplen, stacklen);
+		return entry;
+	}
+
+	public:
+	void test_entry_size() {
+		byte *entry = makeEntry(10, 0, 36);
+		TS_ASSERT_EQUALS(Glk::Glulx::UndoChain::entrySize(entry), 58u);
+		free(entry);
+	}
+
+	void test_save_and_restore() {
+		Glk::Glulx::UndoChain chain;
+		TS_ASSERT(chain.init(8));
+
+		uint expected = 0;
+		for (uint ix = 0; ix < 5; ix++) {
+			chain.push(makeEntry(10 * ix, 4, 20 + ix), 0x400000);
+			expected += 12 + 10 * ix + 4 + 20 + ix;
+			TS_ASSERT_EQUALS(chain.count(), (int)ix + 1);
+			TS_ASSERT_EQUALS(chain.bytes(), expected);
+		}
+
+		for (int ix = 4; ix >= 0; ix--) {
+			byte *entry = chain.newest();
+			TS_ASSERT_EQUALS(READ_BE_UINT32(entry), (uint32)(10 * ix));
+			expected -= Glk::Glulx::UndoChain::entrySize(entry);
+			chain.pop();
+			TS_ASSERT_EQUALS(chain.count(), ix);
+			TS_ASSERT_EQUALS(chain.bytes(), expected);
+		}
+
+		TS_ASSERT_EQUALS(chain.bytes(), 0u);
+		TS_ASSERT(chain.newest() == nullptr);
+	}
+
+	void test_level_limit() {
+		Glk::Glulx::UndoChain chain;
+		TS_ASSERT(chain.init(3));
+
+		for (uint ix = 0; ix < 6; ix++)
+			chain.push(makeEntry(ix, 0, 100), 0x400000);
+
+		// Only the three newest states are kept
+		TS_ASSERT_EQUALS(chain.count(), 3);
+		TS_ASSERT_EQUALS(chain.bytes(), (12u + 5 + 100) + (12u + 4 + 100) + (12u + 3 + 100));
+		TS_ASSERT_EQUALS(READ_BE_UINT32(chain.newest()), 5u);
+	}
+
+	void test_size_limit() {
+		Glk::Glulx::UndoChain chain;
+		TS_ASSERT(chain.init(8));
+
+		// Each state takes 100 bytes, so only three fit in 350
+		for (uint ix = 0; ix < 8; ix++) {
+			chain.push(makeEntry(88 - 16, 16, 0), 350);
+			TS_ASSERT_EQUALS(chain.count(), (int)MIN<uint>(ix + 1, 3));
+			TS_ASSERT_EQUALS(chain.bytes(), 100u * chain.count());
+		}
+
+		// The newest state is kept even when it's too big on its own
+		chain.push(makeEntry(500, 0, 0), 350);
+		TS_ASSERT_EQUALS(chain.count(), 1);
+		TS_ASSERT_EQUALS(chain.bytes(), 512u);
+
+		chain.pop();
+		TS_ASSERT_EQUALS(chain.count(), 0);
+		TS_ASSERT_EQUALS(chain.bytes(), 0u);
+	}
+};
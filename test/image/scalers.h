@@ -0,0 +1,184 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+#include "test/instrset_detect.h"
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/random.h"
+#include "common/system.h"
+
+#include "graphics/scalerplugin.h"
+#include "graphics/scaler/normal.h"
+#ifdef USE_SCALERS
+#include "graphics/scaler/dotmatrix.h"
+#include "graphics/scaler/pm.h"
+#include "graphics/scaler/sai.h"
+#include "graphics/scaler/scalebit.h"
+#include "graphics/scaler/tv.h"
+#ifdef USE_HQ_SCALERS
+#include "graphics/scaler/hq.h"
+#endif
+#ifdef USE_EDGE_SCALERS
+#include "graphics/scaler/edge.h"
+#endif
+#endif
+
+#include "../null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
+
+class ScalerTestSuite : public CxxTest::TestSuite {
+	// Enough border for the scaler looking furthest outside its rect (AdvMame4x)
+	static const int kPadding = 4;
+
+	Common::Array<Scaler *> createScalers(const Graphics::PixelFormat &format) {
+		Common::Array<Scaler *> scalers;
+		scalers.push_back(new NormalScaler(format));
+#ifdef USE_SCALERS
+		scalers.push_back(new DotMatrixScaler(format));
+		scalers.push_back(new PMScaler(format));
+		scalers.push_back(new SAIScaler(format));
+		scalers.push_back(new SuperSAIScaler(format));
+		scalers.push_back(new SuperEagleScaler(format));
+		scalers.push_back(new AdvMameScaler(format));
+		scalers.push_back(new TVScaler(format));
+#ifdef USE_HQ_SCALERS
+		scalers.push_back(new HQScaler(format));
+#endif
+#ifdef USE_EDGE_SCALERS
+		scalers.push_back(new EdgeScaler(format));
+#endif
+#endif
+		return scalers;
+	}
+
+	void fillSource(byte *src, int size, uint32 seed) {
+		// Blocks of random colors, so that edge detecting scalers find some edges
+		Common::RandomSource rnd("scalers");
+		rnd.setSeed(seed);
+		for (int i = 0; i < size; i += 4) {
+			uint32 color = rnd.getRandomNumber(0xFFFFFFFF);
+			int run = MIN<int>(size - i, 4 * (1 + rnd.getRandomNumber(7)));
+			for (int j = 0; j < run; j += 4)
+				memcpy(src + i + j, &color, MIN(4, size - i - j));
+			i += run - 4;
+		}
+	}
+
+public:
+	void test_hq_patterns() {
+#ifdef USE_HQ_SCALERS
+		const int width = 37;
+		uint32 yuv[3][width + 2];
+		uint8 expected[width], patterns[width];
+
+		Common::RandomSource rnd("scalers");
+		for (int n = 0; n < 200; n++) {
+			// Small steps around a base color, so that both sides of each threshold get hit
+			const uint32 base = 0x404040 + rnd.getRandomNumber(0x7F7F7F);
+			for (int row = 0; row < 3; row++) {
+				for (int i = 0; i < width + 2; i++) {
+					uint32 y = ((base >> 16) & 0xFF) + rnd.getRandomNumber(0x70) - 0x38;
+					uint32 u = ((base >> 8) & 0xFF) + rnd.getRandomNumber(16) - 8;
+					uint32 v = (base & 0xFF) + rnd.getRandomNumber(14) - 7;
+					yuv[row][i] = (y << 16) | (u << 8) | v;
+				}
+			}
+
+			HQScaler::computePatternsGeneric(yuv[0], yuv[1], yuv[2], expected, width);
+#ifdef SCUMMVM_NEON
+			HQScaler::computePatternsNEON(yuv[0], yuv[1], yuv[2], patterns, width);
+			TS_ASSERT_SAME_DATA(expected, patterns, width);
+#endif
+#ifdef SCUMMVM_SSE2
+			if (instrset_detect() >= 2) {
+				HQScaler::computePatternsSSE2(yuv[0], yuv[1], yuv[2], patterns, width);
+				TS_ASSERT_SAME_DATA(expected, patterns, width);
+			}
+#endif
+#ifdef SCUMMVM_AVX2
+			if (instrset_detect() >= 8) {
+				HQScaler::computePatternsAVX2(yuv[0], yuv[1], yuv[2], patterns, width);
+				TS_ASSERT_SAME_DATA(expected, patterns, width);
+			}
+#endif
+		}
+#endif
+	}
+
+	void test_scaler_throughput() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+
+		const int width = 320, height = 200;
+		const Graphics::PixelFormat format(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		const uint32 srcPitch = (width + kPadding * 2) * 2;
+		const int srcSize = (height + kPadding * 2) * srcPitch;
+		byte *src = new byte[srcSize];
+		fillSource(src, srcSize, 0xBE4C4);
+		const byte *srcRect = src + kPadding * srcPitch + kPadding * 2;
+
+#ifdef SLOW_TESTS
+		const int iterations = 200;
+#else
+		const int iterations = 10;
+#endif
+
+#ifdef USE_HQ_SCALERS
+		// Skip the CPU feature detection, which needs a backend, and leave
+		// the pattern function as the other tests expect it
+		const HQScaler::PatternFunc oldPatterns = HQScaler::computePatterns;
+		HQScaler::computePatterns = HQScaler::computePatternsGeneric;
+#endif
+
+		Common::Array<Scaler *> scalers = createScalers(format);
+		for (uint i = 0; i < scalers.size(); ++i) {
+			Scaler *scaler = scalers[i];
+			const uint factor = scaler->getFactor();
+			const uint32 dstPitch = width * factor * 2;
+			byte *dst = new byte[height * factor * dstPitch];
+
+			uint32 start = g_system->getMillis();
+			for (int n = 0; n < iterations; ++n)
+				scaler->scale(srcRect, srcPitch, dst, dstPitch, width, height, 0, 0);
+			uint32 elapsed = g_system->getMillis() - start;
+
+			debug("Scaler %u (%ux): %.2f Mpix/s", i, factor,
+			      (double)width * height * iterations / (MAX<uint32>(elapsed, 1) * 1000.0));
+
+			delete[] dst;
+			delete scaler;
+		}
+#ifdef USE_HQ_SCALERS
+		HQScaler::computePatterns = oldPatterns;
+#endif
+		delete[] src;
+#endif
+	}
+};
@@ -0,0 +1,219 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+#include "test/instrset_detect.h"
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/random.h"
+#include "common/system.h"
+
+#include "math/fft.h"
+#include "math/mdct.h"
+#include "math/utils.h"
+
+#include "../null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
+
+class FFTTestSuite : public CxxTest::TestSuite {
+	static void fillInput(Math::Complex *z, int n, Common::RandomSource &rnd) {
+		for (int i = 0; i < n; i++) {
+			z[i].re = (int)rnd.getRandomNumber(2000) / 1000.0f - 1.0f;
+			z[i].im = (int)rnd.getRandomNumber(2000) / 1000.0f - 1.0f;
+		}
+	}
+
+	static void transform(Math::FFT::PassFunc func, int bits, int inverse, Math::Complex *z) {
+		// Leave the pass function as the other tests expect it
+		const Math::FFT::PassFunc oldPass = Math::FFT::transformPass;
+		Math::FFT::transformPass = func;
+		Math::FFT fft(bits, inverse);
+		fft.permute(z);
+		fft.calc(z);
+		Math::FFT::transformPass = oldPass;
+	}
+
+	static void checkClose(const Math::Complex *expected, const Math::Complex *z, int n, float tolerance) {
+		for (int i = 0; i < n; i++) {
+			TS_ASSERT_DELTA(z[i].re, expected[i].re, tolerance);
+			TS_ASSERT_DELTA(z[i].im, expected[i].im, tolerance);
+		}
+	}
+
+public:
+	void test_dft() {
+		Common::RandomSource rnd("fft");
+		for (int bits = 2; bits <= 9; bits++) {
+			for (int inverse = 0; inverse <= 1; inverse++) {
+				const int n = 1 << bits;
+				Math::Complex *input = new Math::Complex[n];
+				Math::Complex *expected = new Math::Complex[n];
+				Math::Complex *z = new Math::Complex[n];
+				fillInput(input, n, rnd);
+
+				// Naive DFT for reference
+				const double sign = inverse ? 1.0 : -1.0;
+				for (int k = 0; k < n; k++) {
+					double re = 0.0, im = 0.0;
+					for (int i = 0; i < n; i++) {
+						const double angle = sign * 2.0 * M_PI * ((i * k) % n) / n;
+						re += input[i].re * cos(angle) - input[i].im * sin(angle);
+						im += input[i].re * sin(angle) + input[i].im * cos(angle);
+					}
+					expected[k].re = re;
+					expected[k].im = im;
+				}
+
+				memcpy(z, input, n * sizeof(Math::Complex));
+				transform(Math::FFT::transformPassGeneric, bits, inverse, z);
+				checkClose(expected, z, n, 1e-4f * n);
+
+				delete[] z;
+				delete[] expected;
+				delete[] input;
+			}
+		}
+	}
+
+	void test_simd_passes() {
+		Common::RandomSource rnd("fft");
+		for (int bits = 5; bits <= 12; bits++) {
+			const int n = 1 << bits;
+			Math::Complex *input = new Math::Complex[n];
+			Math::Complex *expected = new Math::Complex[n];
+			Math::Complex *z = new Math::Complex[n];
+			fillInput(input, n, rnd);
+
+			memcpy(expected, input, n * sizeof(Math::Complex));
+			transform(Math::FFT::transformPassGeneric, bits, 0, expected);
+
+			// The passes only reorder the operations on the sign of zero results
+			const float tolerance = 1e-6f * n;
+#ifdef SCUMMVM_NEON
+			memcpy(z, input, n * sizeof(Math::Complex));
+			transform(Math::FFT::transformPassNEON, bits, 0, z);
+			checkClose(expected, z, n, tolerance);
+#endif
+#ifdef SCUMMVM_SSE2
+			if (instrset_detect() >= 2) {
+				memcpy(z, input, n * sizeof(Math::Complex));
+				transform(Math::FFT::transformPassSSE2, bits, 0, z);
+				checkClose(expected, z, n, tolerance);
+			}
+#endif
+#ifdef SCUMMVM_AVX2
+			if (instrset_detect() >= 8) {
+				memcpy(z, input, n * sizeof(Math::Complex));
+				transform(Math::FFT::transformPassAVX2, bits, 0, z);
+				checkClose(expected, z, n, tolerance);
+			}
+#endif
+			(void)tolerance;
+
+			delete[] z;
+			delete[] expected;
+			delete[] input;
+		}
+	}
+
+	void test_transform_throughput() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+
+		Common::Array<Math::FFT::PassFunc> funcs;
+		Common::Array<const char *> names;
+		funcs.push_back(Math::FFT::transformPassGeneric);
+		names.push_back("generic");
+#ifdef SCUMMVM_NEON
+		funcs.push_back(Math::FFT::transformPassNEON);
+		names.push_back("NEON");
+#endif
+#ifdef SCUMMVM_SSE2
+		if (instrset_detect() >= 2) {
+			funcs.push_back(Math::FFT::transformPassSSE2);
+			names.push_back("SSE2");
+		}
+#endif
+#ifdef SCUMMVM_AVX2
+		if (instrset_detect() >= 8) {
+			funcs.push_back(Math::FFT::transformPassAVX2);
+			names.push_back("AVX2");
+		}
+#endif
+
+#ifdef SLOW_TESTS
+		const int samples = 1 << 24;
+#else
+		const int samples = 1 << 18;
+#endif
+
+		// The FFT sizes used by the MDCTs of WMA, QDM2 and Bink audio, and a few more
+		static const int sizes[] = { 6, 7, 8, 9, 10, 11, 12 };
+		Math::Complex *input = new Math::Complex[1 << 12];
+		Math::Complex *z = new Math::Complex[1 << 12];
+		float *output = new float[1 << 14];
+		const Math::FFT::PassFunc oldPass = Math::FFT::transformPass;
+		for (uint f = 0; f < funcs.size(); f++) {
+			for (int s = 0; s < ARRAYSIZE(sizes); s++) {
+				const int bits = sizes[s];
+				const int iterations = samples >> bits;
+				for (int i = 0; i < (1 << bits); i++) {
+					input[i].re = (i % 7) * 0.25f;
+					input[i].im = (i % 5) * -0.25f;
+				}
+
+				Math::FFT::transformPass = funcs[f];
+				Math::FFT fft(bits, 0);
+				uint32 start = g_system->getMillis();
+				// Start from the same input every time, so the values don't overflow
+				for (int n = 0; n < iterations; n++) {
+					memcpy(z, input, sizeof(Math::Complex) << bits);
+					fft.calc(z);
+				}
+				uint32 fftTime = g_system->getMillis() - start;
+
+				// The inverse MDCT of 2^(bits + 2) points runs an FFT of 2^bits points
+				Math::MDCT mdct(bits + 2, true, 1.0);
+				start = g_system->getMillis();
+				for (int n = 0; n < iterations; n++)
+					mdct.calcIMDCT(output, &input[0].re);
+				uint32 mdctTime = g_system->getMillis() - start;
+
+				debug("FFT %s %d points: %.0f transforms/s, IMDCT %d points: %.0f transforms/s", names[f], 1 << bits,
+				      iterations * 1000.0 / MAX<uint32>(fftTime, 1), 1 << (bits + 2),
+				      iterations * 1000.0 / MAX<uint32>(mdctTime, 1));
+			}
+		}
+		Math::FFT::transformPass = oldPass;
+		delete[] output;
+		delete[] z;
+		delete[] input;
+#endif
+	}
+};
@@ -39,6 +39,11 @@ ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TEST_LIBS += engines/wintermute/libwintermute.a
 endif
 
+ifeq ($(ENABLE_GLK), STATIC_PLUGIN)
+	TESTS += $(srcdir)/test/engines/glk/*.h
+	TEST_LIBS += engines/glk/libglk.a
+endif
+
 ifeq ($(ENABLE_ULTIMA), STATIC_PLUGIN)
 ifdef ENABLE_ULTIMA1
 	TESTS += $(srcdir)/test/engines/ultima/shared/*/*.h